@@ -0,0 +1,86 @@
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "../lib/s21_channel.h"
+#include "bench_utils.h"
+
+namespace {
+const int kRoundTrips = 200000;
+
+s21::Detached ping(s21::Channel<int> &out, s21::Channel<int> &in) {
+  for (int i = 0; i < kRoundTrips; ++i) {
+    co_await out.push(i);
+    co_await in.pop();
+  }
+  out.close();
+}
+
+s21::Detached pong(s21::Channel<int> &in, s21::Channel<int> &out) {
+  while (auto value = co_await in.pop()) co_await out.push(*value);
+}
+
+double run_channel() {
+  s21::RunLoop loop;
+  s21::Channel<int> to_pong(loop, 1);
+  s21::Channel<int> to_ping(loop, 1);
+  bench::Timer timer;
+  pong(to_pong, to_ping);
+  ping(to_pong, to_ping);
+  loop.run();
+  return timer.seconds();
+}
+
+// The thread-per-stage version: a mutex and condition variable handoff.
+class Handoff {
+ public:
+  void put(int value) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this] { return !full_; });
+    value_ = value;
+    full_ = true;
+    cv_.notify_all();
+  }
+
+  int take() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this] { return full_; });
+    full_ = false;
+    cv_.notify_all();
+    return value_;
+  }
+
+ private:
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  bool full_ = false;
+  int value_ = 0;
+};
+
+double run_condition_variable() {
+  Handoff to_pong;
+  Handoff to_ping;
+  bench::Timer timer;
+  std::thread ponger([&] {
+    for (int i = 0; i < kRoundTrips; ++i) to_ping.put(to_pong.take());
+  });
+  for (int i = 0; i < kRoundTrips; ++i) {
+    to_pong.put(i);
+    bench::do_not_optimize(to_ping.take());
+  }
+  ponger.join();
+  return timer.seconds();
+}
+}  // namespace
+
+int main() {
+  std::cout << "Ping-pong, " << kRoundTrips << " round trips" << std::endl;
+  double channel = run_channel();
+  bench::report("Channel co_await on RunLoop", channel, kRoundTrips);
+  std::cout << "  latency " << channel / kRoundTrips * 1e9 << " ns"
+            << std::endl;
+  double cv = run_condition_variable();
+  bench::report("condition_variable handoff", cv, kRoundTrips);
+  std::cout << "  latency " << cv / kRoundTrips * 1e9 << " ns" << std::endl;
+  return 0;
+}
@@ -0,0 +1,154 @@
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <random>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../lib/s21_concurrent_hash_map.h"
+#include "../lib/s21_concurrent_map.h"
+#include "../lib/s21_unordered_map.h"
+#include "bench_utils.h"
+
+namespace {
+const std::size_t kKeys = 1 << 16;
+const std::size_t kOpsPerThread = 400000;
+const std::uint64_t kGrowKeys = 1000000;
+const int kReaders = 3;
+
+// One reader-writer lock around a hash map.
+class LockedHashMap {
+ public:
+  bool find(std::uint64_t key, std::uint64_t &out) {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    auto it = map_.find(key);
+    if (it == map_.end()) return false;
+    out = it->second;
+    return true;
+  }
+
+  void insert_or_assign(std::uint64_t key, std::uint64_t value) {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    map_.insert_or_assign(key, value);
+  }
+
+ private:
+  std::shared_mutex mutex_;
+  s21::UnorderedMap<std::uint64_t, std::uint64_t> map_;
+};
+
+template <typename MapType>
+double run_mixed(MapType &map, int threads, unsigned write_percent) {
+  for (std::uint64_t key = 0; key < kKeys; key += 2) {
+    map.insert_or_assign(key, key);
+  }
+  std::vector<std::thread> workers;
+  bench::Timer timer;
+  for (int t = 0; t < threads; ++t) {
+    workers.emplace_back([&map, t, write_percent] {
+      std::mt19937_64 rng(t + 1);
+      std::uint64_t value = 0;
+      for (std::size_t i = 0; i < kOpsPerThread; ++i) {
+        std::uint64_t key = rng() % kKeys;
+        if (rng() % 100 < write_percent) {
+          map.insert_or_assign(key, i);
+        } else {
+          map.find(key, value);
+        }
+      }
+      bench::do_not_optimize(value);
+    });
+  }
+  for (std::thread &worker : workers) worker.join();
+  return timer.seconds();
+}
+
+struct GrowResult {
+  double writer_seconds;
+  double reader_seconds;
+  std::uint64_t lookups;
+};
+
+// Readers look up a fixed key set while one writer grows the map from
+// kKeys / 2 to kGrowKeys more elements, resizing it several times unless
+// it was reserved up front.
+template <typename MapType>
+GrowResult run_growth(MapType &map) {
+  for (std::uint64_t key = 0; key < kKeys; key += 2) {
+    map.insert_or_assign(key, key);
+  }
+  std::atomic<bool> done{false};
+  std::atomic<std::uint64_t> lookups{0};
+  std::vector<std::thread> readers;
+  bench::Timer timer;
+  for (int t = 0; t < kReaders; ++t) {
+    readers.emplace_back([&map, &done, &lookups, t] {
+      std::mt19937_64 rng(t + 1);
+      std::uint64_t value = 0;
+      std::uint64_t count = 0;
+      while (!done.load(std::memory_order_relaxed)) {
+        for (int i = 0; i < 256; ++i) map.find(rng() % kKeys, value);
+        count += 256;
+      }
+      lookups.fetch_add(count);
+      bench::do_not_optimize(value);
+    });
+  }
+  for (std::uint64_t key = 0; key < kGrowKeys; ++key) {
+    map.insert_or_assign(kKeys + key, key);
+  }
+  GrowResult result;
+  result.writer_seconds = timer.seconds();
+  done.store(true);
+  for (std::thread &reader : readers) reader.join();
+  result.reader_seconds = timer.seconds();
+  result.lookups = lookups.load();
+  return result;
+}
+
+void report_growth(const std::string &name, const GrowResult &result) {
+  bench::report(name + " writer", result.writer_seconds, kGrowKeys);
+  bench::report(name + " readers", result.reader_seconds, result.lookups);
+}
+}  // namespace
+
+int main() {
+  using Striped = s21::ConcurrentHashMap<std::uint64_t, std::uint64_t>;
+  using Sharded = s21::ConcurrentMap<std::uint64_t, std::uint64_t>;
+  std::cout << "uint64_t -> uint64_t, " << kKeys << " keys, "
+            << kOpsPerThread << " operations per thread" << std::endl;
+  for (unsigned write_percent : {1u, 10u}) {
+    for (int threads : {1, 2, 4, 8}) {
+      std::string suffix = ", " + std::to_string(write_percent) + "% w, " +
+                           std::to_string(threads) + " thr";
+      std::size_t ops = kOpsPerThread * threads;
+      LockedHashMap locked;
+      bench::report("shared_mutex UnorderedMap" + suffix,
+                    run_mixed(locked, threads, write_percent), ops);
+      Sharded sharded;
+      bench::report("s21::ConcurrentMap" + suffix,
+                    run_mixed(sharded, threads, write_percent), ops);
+      Striped striped;
+      bench::report("s21::ConcurrentHashMap" + suffix,
+                    run_mixed(striped, threads, write_percent), ops);
+    }
+  }
+
+  std::cout << kReaders << " readers while one writer adds " << kGrowKeys
+            << " keys" << std::endl;
+  {
+    LockedHashMap locked;
+    report_growth("shared_mutex UnorderedMap", run_growth(locked));
+  }
+  {
+    Striped striped;
+    report_growth("ConcurrentHashMap growing", run_growth(striped));
+  }
+  {
+    Striped striped(kKeys + kGrowKeys);
+    report_growth("ConcurrentHashMap reserved", run_growth(striped));
+  }
+  return 0;
+}
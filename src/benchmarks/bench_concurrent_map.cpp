@@ -0,0 +1,84 @@
+#include <cstdint>
+#include <mutex>
+#include <random>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../lib/s21_concurrent_map.h"
+#include "../lib/s21_map.h"
+#include "bench_utils.h"
+
+namespace {
+const std::size_t kKeys = 1 << 16;
+const std::size_t kOpsPerThread = 200000;
+
+// The wrapper this container replaces: one reader-writer lock for the
+// whole map.
+class LockedMap {
+ public:
+  bool find(std::uint64_t key, std::uint64_t &out) {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    auto it = map_.find(key);
+    if (it == map_.end()) return false;
+    out = (*it).second;
+    return true;
+  }
+
+  void insert_or_assign(std::uint64_t key, std::uint64_t value) {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    map_.insert_or_assign(key, value);
+  }
+
+ private:
+  std::shared_mutex mutex_;
+  s21::Map<std::uint64_t, std::uint64_t> map_;
+};
+
+template <typename MapType>
+double run_mixed(MapType &map, int threads, unsigned write_percent) {
+  for (std::uint64_t key = 0; key < kKeys; key += 2) {
+    map.insert_or_assign(key, key);
+  }
+  std::vector<std::thread> workers;
+  bench::Timer timer;
+  for (int t = 0; t < threads; ++t) {
+    workers.emplace_back([&map, t, write_percent] {
+      std::mt19937_64 rng(t + 1);
+      std::uint64_t value = 0;
+      for (std::size_t i = 0; i < kOpsPerThread; ++i) {
+        std::uint64_t key = rng() % kKeys;
+        if (rng() % 100 < write_percent) {
+          map.insert_or_assign(key, i);
+        } else {
+          map.find(key, value);
+        }
+      }
+      bench::do_not_optimize(value);
+    });
+  }
+  for (std::thread &worker : workers) worker.join();
+  return timer.seconds();
+}
+}  // namespace
+
+int main() {
+  using Sharded = s21::ConcurrentMap<std::uint64_t, std::uint64_t>;
+  std::cout << "Map<uint64_t, uint64_t>, " << kKeys << " keys, "
+            << kOpsPerThread << " operations per thread" << std::endl;
+  for (unsigned write_percent : {5u, 50u}) {
+    for (int threads : {1, 2, 4, 8}) {
+      std::string suffix = ", " + std::to_string(write_percent) +
+                           "% writes, " + std::to_string(threads) + " thr";
+      std::size_t ops = kOpsPerThread * threads;
+      LockedMap locked;
+      bench::report("shared_mutex Map" + suffix,
+                    run_mixed(locked, threads, write_percent), ops);
+      Sharded sharded;
+      bench::report("s21::ConcurrentMap" + suffix,
+                    run_mixed(sharded, threads, write_percent), ops);
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,103 @@
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../lib/s21_concurrent_queue.h"
+#include "bench_utils.h"
+
+namespace {
+const std::size_t kItems = 1 << 19;
+const std::size_t kBatch = 64;
+
+// The hand-written wrapper this container replaces: one notify and one lock
+// acquisition per element, and elements are copied in and out.
+class NaiveQueue {
+ public:
+  void push(const std::string &value) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    not_full_.wait(lock, [this] { return queue_.size() < 1024; });
+    queue_.push(value);
+    lock.unlock();
+    not_empty_.notify_one();
+  }
+
+  bool pop(std::string &value) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    not_empty_.wait(lock, [this] { return !queue_.empty() || closed_; });
+    if (queue_.empty()) return false;
+    value = queue_.front();
+    queue_.pop();
+    lock.unlock();
+    not_full_.notify_one();
+    return true;
+  }
+
+  void close() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      closed_ = true;
+    }
+    not_empty_.notify_all();
+  }
+
+ private:
+  s21::Queue<std::string> queue_;
+  bool closed_ = false;
+  std::mutex mutex_;
+  std::condition_variable not_full_;
+  std::condition_variable not_empty_;
+};
+
+double run_naive(int consumers) {
+  NaiveQueue queue;
+  std::vector<std::thread> threads;
+  bench::Timer timer;
+  for (int c = 0; c < consumers; ++c) {
+    threads.emplace_back([&queue] {
+      std::string value;
+      while (queue.pop(value)) bench::do_not_optimize(value);
+    });
+  }
+  std::string payload(64, 'x');
+  for (std::size_t i = 0; i < kItems; ++i) queue.push(payload);
+  queue.close();
+  for (auto &thread : threads) thread.join();
+  return timer.seconds();
+}
+
+double run_bulk(int consumers) {
+  s21::ConcurrentQueue<std::string> queue(1024);
+  std::vector<std::thread> threads;
+  bench::Timer timer;
+  for (int c = 0; c < consumers; ++c) {
+    threads.emplace_back([&queue] {
+      std::vector<std::string> out(kBatch);
+      while (queue.pop_bulk(out.begin(), kBatch) != 0) {
+        bench::do_not_optimize(out);
+      }
+    });
+  }
+  std::vector<std::string> batch(kBatch);
+  for (std::size_t i = 0; i < kItems; i += kBatch) {
+    for (auto &item : batch) item.assign(64, 'x');
+    queue.push_bulk(batch.begin(), batch.end());
+  }
+  queue.close();
+  for (auto &thread : threads) thread.join();
+  return timer.seconds();
+}
+}  // namespace
+
+int main() {
+  std::cout << "ConcurrentQueue bulk drain vs per-item cv wrapper, " << kItems
+            << " strings" << std::endl;
+  for (int consumers = 1; consumers <= 8; consumers *= 2) {
+    std::string suffix = " consumers=" + std::to_string(consumers);
+    bench::report("cv wrapper + Queue" + suffix, run_naive(consumers), kItems);
+    bench::report("ConcurrentQueue bulk" + suffix, run_bulk(consumers),
+                  kItems);
+  }
+  return 0;
+}
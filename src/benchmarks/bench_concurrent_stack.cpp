@@ -0,0 +1,65 @@
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../lib/s21_concurrent_stack.h"
+#include "../lib/s21_stack.h"
+#include "bench_utils.h"
+
+namespace {
+const std::size_t kOperations = 1 << 20;
+
+class LockedStack {
+ public:
+  void push(int value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stack_.push(value);
+  }
+
+  bool try_pop(int &value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stack_.empty()) return false;
+    value = stack_.top();
+    stack_.pop();
+    return true;
+  }
+
+ private:
+  std::mutex mutex_;
+  s21::Stack<int> stack_;
+};
+
+// The free-object pool pattern: take an object, then give it back.
+template <typename Stack>
+double run(Stack &stack, int threads) {
+  for (int i = 0; i < 1024; ++i) stack.push(i);
+  std::vector<std::thread> workers;
+  bench::Timer timer;
+  for (int t = 0; t < threads; ++t) {
+    workers.emplace_back([&stack, threads] {
+      int value = 0;
+      for (std::size_t i = 0; i < kOperations / threads; ++i) {
+        if (stack.try_pop(value)) stack.push(value);
+      }
+      bench::do_not_optimize(value);
+    });
+  }
+  for (auto &worker : workers) worker.join();
+  return timer.seconds();
+}
+}  // namespace
+
+int main() {
+  std::cout << "ConcurrentStack vs mutex + s21::Stack, " << kOperations
+            << " pop/push pairs" << std::endl;
+  for (int threads = 1; threads <= 64; threads *= 2) {
+    std::string suffix = " threads=" + std::to_string(threads);
+    s21::ConcurrentStack<int> lock_free;
+    bench::report("ConcurrentStack" + suffix, run(lock_free, threads),
+                  2 * kOperations);
+    LockedStack locked;
+    bench::report("mutex + Stack" + suffix, run(locked, threads),
+                  2 * kOperations);
+  }
+  return 0;
+}
@@ -0,0 +1,78 @@
+#include <cstdint>
+#include <random>
+#include <utility>
+
+#include "../lib/s21_flat_map.h"
+#include "../lib/s21_map.h"
+#include "../lib/s21_vector.h"
+#include "bench_utils.h"
+
+namespace {
+const std::size_t kLookups = 4000000;
+const int kScans = 20;
+
+// Even keys are stored, so odd probes always miss.
+s21::Vector<std::uint64_t> make_probes(std::size_t keys, bool hit,
+                                       std::uint64_t seed) {
+  s21::Vector<std::uint64_t> probes(kLookups);
+  std::mt19937_64 rng(seed);
+  for (std::uint64_t &key : probes) key = (rng() % keys) * 2 + (hit ? 0 : 1);
+  return probes;
+}
+
+template <typename MapType>
+double run_lookups(MapType &map, const s21::Vector<std::uint64_t> &probes) {
+  std::uint64_t found = 0;
+  bench::Timer timer;
+  for (std::uint64_t key : probes) found += map.find(key) != map.end();
+  bench::do_not_optimize(found);
+  return timer.seconds();
+}
+
+template <typename MapType>
+double run_scans(MapType &map) {
+  std::uint64_t sum = 0;
+  bench::Timer timer;
+  for (int scan = 0; scan < kScans; ++scan) {
+    for (auto item : map) sum += item.second;
+  }
+  bench::do_not_optimize(sum);
+  return timer.seconds();
+}
+
+void run(std::size_t keys) {
+  s21::Vector<std::pair<std::uint64_t, std::uint64_t>> items(keys);
+  for (std::size_t i = 0; i < keys; ++i) items[i] = {i * 2, i};
+  std::mt19937_64 rng(keys);
+  for (std::size_t i = keys - 1; i > 0; --i) {
+    std::swap(items[i], items[rng() % (i + 1)]);
+  }
+  s21::Vector<std::uint64_t> hits = make_probes(keys, true, 2);
+  s21::Vector<std::uint64_t> misses = make_probes(keys, false, 3);
+
+  bench::Timer timer;
+  s21::FlatMap<std::uint64_t, std::uint64_t> flat(items.begin(),
+                                                  items.end());
+  double flat_build = timer.seconds();
+  timer = bench::Timer();
+  s21::Map<std::uint64_t, std::uint64_t> tree;
+  for (const auto &item : items) tree.insert(item);
+  double tree_build = timer.seconds();
+
+  std::cout << "uint64_t -> uint64_t, " << keys << " keys" << std::endl;
+  bench::report("s21::FlatMap bulk insert", flat_build, keys);
+  bench::report("s21::Map insert", tree_build, keys);
+  bench::report("s21::FlatMap find hit", run_lookups(flat, hits), kLookups);
+  bench::report("s21::Map find hit", run_lookups(tree, hits), kLookups);
+  bench::report("s21::FlatMap find miss", run_lookups(flat, misses),
+                kLookups);
+  bench::report("s21::Map find miss", run_lookups(tree, misses), kLookups);
+  bench::report("s21::FlatMap iterate", run_scans(flat), keys * kScans);
+  bench::report("s21::Map iterate", run_scans(tree), keys * kScans);
+}
+}  // namespace
+
+int main() {
+  for (std::size_t keys : {1000u, 100000u, 1000000u}) run(keys);
+  return 0;
+}
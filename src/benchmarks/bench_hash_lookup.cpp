@@ -0,0 +1,77 @@
+#include <cstdint>
+#include <random>
+#include <unordered_map>
+
+#include "../lib/s21_map.h"
+#include "../lib/s21_unordered_map.h"
+#include "../lib/s21_vector.h"
+#include "bench_utils.h"
+
+namespace {
+const std::size_t kKeys = 1000000;
+const std::size_t kLookups = 4000000;
+
+// Even keys are stored, so odd probes always miss.
+s21::Vector<std::uint64_t> make_probes(std::size_t count, bool hit,
+                                       std::uint64_t seed) {
+  s21::Vector<std::uint64_t> probes(count);
+  std::mt19937_64 rng(seed);
+  for (std::uint64_t &key : probes) key = (rng() % kKeys) * 2 + (hit ? 0 : 1);
+  return probes;
+}
+
+template <typename MapType>
+void fill(MapType &map, const s21::Vector<std::uint64_t> &keys) {
+  for (std::uint64_t key : keys) map.insert({key, key});
+}
+
+template <typename MapType>
+double run_lookups(MapType &map, const s21::Vector<std::uint64_t> &probes) {
+  std::uint64_t found = 0;
+  bench::Timer timer;
+  for (std::uint64_t key : probes) found += map.find(key) != map.end();
+  bench::do_not_optimize(found);
+  return timer.seconds();
+}
+}  // namespace
+
+int main() {
+  s21::Vector<std::uint64_t> keys(kKeys);
+  for (std::size_t i = 0; i < kKeys; ++i) keys[i] = i * 2;
+  std::mt19937_64 rng(1);
+  for (std::size_t i = kKeys - 1; i > 0; --i) {
+    std::swap(keys[i], keys[rng() % (i + 1)]);
+  }
+  s21::Vector<std::uint64_t> hits = make_probes(kLookups, true, 2);
+  s21::Vector<std::uint64_t> misses = make_probes(kLookups, false, 3);
+
+  s21::UnorderedMap<std::uint64_t, std::uint64_t> swiss;
+  std::unordered_map<std::uint64_t, std::uint64_t> chained;
+  s21::Map<std::uint64_t, std::uint64_t> tree;
+  bench::Timer timer;
+  fill(swiss, keys);
+  double swiss_fill = timer.seconds();
+  timer = bench::Timer();
+  fill(chained, keys);
+  double chained_fill = timer.seconds();
+  timer = bench::Timer();
+  fill(tree, keys);
+  double tree_fill = timer.seconds();
+
+  std::cout << "uint64_t -> uint64_t, " << kKeys << " keys" << std::endl;
+  bench::report("s21::UnorderedMap insert", swiss_fill, kKeys);
+  bench::report("std::unordered_map insert", chained_fill, kKeys);
+  bench::report("s21::Map insert", tree_fill, kKeys);
+  std::cout << kLookups << " lookups that hit" << std::endl;
+  bench::report("s21::UnorderedMap find", run_lookups(swiss, hits), kLookups);
+  bench::report("std::unordered_map find", run_lookups(chained, hits),
+                kLookups);
+  bench::report("s21::Map find", run_lookups(tree, hits), kLookups);
+  std::cout << kLookups << " lookups that miss" << std::endl;
+  bench::report("s21::UnorderedMap find", run_lookups(swiss, misses),
+                kLookups);
+  bench::report("std::unordered_map find", run_lookups(chained, misses),
+                kLookups);
+  bench::report("s21::Map find", run_lookups(tree, misses), kLookups);
+  return 0;
+}
@@ -0,0 +1,99 @@
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <thread>
+
+#include "../lib/s21_map.h"
+#include "../lib/s21_parallel_tree.h"
+#include "../lib/s21_vector.h"
+#include "bench_utils.h"
+
+namespace {
+// 50M entries take about 4.5 GB; pass the size as the first argument.
+const std::size_t kDefaultEntries = 10000000;
+const std::size_t kBuckets = 64;
+
+using EntryMap = s21::Map<std::uint64_t, std::uint64_t>;
+
+struct Summary {
+  std::uint64_t sum = 0;
+  std::uint64_t counts[kBuckets] = {};
+};
+
+Summary add(Summary summary, const EntryMap::value_type &item) {
+  summary.sum += item.second;
+  ++summary.counts[item.second % kBuckets];
+  return summary;
+}
+
+Summary merge(Summary left, const Summary &right) {
+  left.sum += right.sum;
+  for (std::size_t i = 0; i < kBuckets; ++i) left.counts[i] += right.counts[i];
+  return left;
+}
+
+double run_sequential(EntryMap &map) {
+  bench::Timer timer;
+  Summary summary;
+  for (auto it = map.begin(); it != map.end(); ++it) {
+    summary = add(summary, *it);
+  }
+  bench::do_not_optimize(summary.sum);
+  return timer.seconds();
+}
+
+double run_parallel(EntryMap &map, std::size_t threads) {
+  s21::TaskScheduler scheduler(threads);
+  bench::Timer timer;
+  Summary summary = s21::parallel_reduce(
+      scheduler, map, Summary(),
+      [](Summary &acc, const EntryMap::value_type &item) {
+        acc.sum += item.second;
+        ++acc.counts[item.second % kBuckets];
+      },
+      [](Summary left, const Summary &right) { return merge(left, right); });
+  bench::do_not_optimize(summary.sum);
+  return timer.seconds();
+}
+
+double run_sequential_export(EntryMap &map) {
+  bench::Timer timer;
+  s21::Vector<std::pair<std::uint64_t, std::uint64_t>> rows(map.size());
+  std::size_t at = 0;
+  for (auto it = map.begin(); it != map.end(); ++it) rows[at++] = *it;
+  bench::do_not_optimize(rows.size());
+  return timer.seconds();
+}
+
+double run_export(EntryMap &map, std::size_t threads) {
+  s21::TaskScheduler scheduler(threads);
+  bench::Timer timer;
+  auto rows = s21::parallel_export(scheduler, map);
+  bench::do_not_optimize(rows.size());
+  return timer.seconds();
+}
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  std::size_t entries =
+      argc > 1 ? std::strtoull(argv[1], nullptr, 10) : kDefaultEntries;
+  s21::Vector<std::pair<std::uint64_t, std::uint64_t>> sorted(entries);
+  for (std::size_t i = 0; i < entries; ++i) sorted[i] = {i * 7, i * 31};
+  EntryMap map(sorted.begin(), sorted.end());
+  sorted.clear();
+  std::cout << "Map<uint64_t, uint64_t>, " << entries
+            << " entries, sum + histogram ("
+            << std::thread::hardware_concurrency() << " hardware threads)"
+            << std::endl;
+  bench::report("iterator walk", run_sequential(map), entries);
+  for (std::size_t threads : {1, 2, 4, 8}) {
+    bench::report("parallel_reduce, " + std::to_string(threads) + " workers",
+                  run_parallel(map, threads), entries);
+  }
+  bench::report("iterator export", run_sequential_export(map), entries);
+  for (std::size_t threads : {1, 2, 4, 8}) {
+    bench::report("parallel_export, " + std::to_string(threads) + " workers",
+                  run_export(map, threads), entries);
+  }
+  return 0;
+}
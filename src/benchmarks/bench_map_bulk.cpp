@@ -0,0 +1,91 @@
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <utility>
+
+#include "../lib/s21_map.h"
+#include "../lib/s21_vector.h"
+#include "bench_utils.h"
+
+namespace {
+const std::size_t kKeys = 5000000;
+const std::size_t kUpdates = 2000000;
+
+using Item = std::pair<std::uint64_t, std::uint64_t>;
+
+s21::Vector<Item> make_sorted(std::size_t count, std::uint64_t seed) {
+  s21::Vector<Item> items(count);
+  std::mt19937_64 rng(seed);
+  for (Item &item : items) item = {rng(), rng()};
+  std::sort(items.begin(), items.end());
+  return items;
+}
+
+template <typename MapType>
+double run_insert(const s21::Vector<Item> &items) {
+  bench::Timer timer;
+  MapType map;
+  for (const Item &item : items) map.insert(item);
+  bench::do_not_optimize(map.size());
+  return timer.seconds();
+}
+
+template <typename MapType>
+double run_hinted(const s21::Vector<Item> &items) {
+  bench::Timer timer;
+  MapType map;
+  for (const Item &item : items) map.emplace_hint(map.end(), item);
+  bench::do_not_optimize(map.size());
+  return timer.seconds();
+}
+
+double run_bulk(const s21::Vector<Item> &items) {
+  bench::Timer timer;
+  s21::Map<std::uint64_t, std::uint64_t> map(items.begin(), items.end());
+  bench::do_not_optimize(map.size());
+  return timer.seconds();
+}
+
+double run_upsert_loop(const s21::Vector<Item> &items,
+                       const s21::Vector<Item> &updates) {
+  s21::Map<std::uint64_t, std::uint64_t> map(items.begin(), items.end());
+  bench::Timer timer;
+  for (const Item &item : updates) {
+    map.insert_or_assign(item.first, item.second);
+  }
+  bench::do_not_optimize(map.size());
+  return timer.seconds();
+}
+
+double run_upsert_sorted(const s21::Vector<Item> &items,
+                         const s21::Vector<Item> &updates) {
+  s21::Map<std::uint64_t, std::uint64_t> map(items.begin(), items.end());
+  bench::Timer timer;
+  map.upsert_sorted(updates.begin(), updates.end());
+  bench::do_not_optimize(map.size());
+  return timer.seconds();
+}
+}  // namespace
+
+int main() {
+  s21::Vector<Item> items = make_sorted(kKeys, 42);
+  s21::Vector<Item> updates = make_sorted(kUpdates, 7);
+  using S21Map = s21::Map<std::uint64_t, std::uint64_t>;
+  using StdMap = std::map<std::uint64_t, std::uint64_t>;
+  std::cout << "Map<uint64_t, uint64_t>, " << kKeys
+            << " sorted keys, load from scratch" << std::endl;
+  bench::report("s21::Map insert", run_insert<S21Map>(items), kKeys);
+  bench::report("std::map insert", run_insert<StdMap>(items), kKeys);
+  bench::report("s21::Map emplace_hint(end)", run_hinted<S21Map>(items),
+                kKeys);
+  bench::report("std::map emplace_hint(end)", run_hinted<StdMap>(items),
+                kKeys);
+  bench::report("s21::Map range constructor", run_bulk(items), kKeys);
+  std::cout << kUpdates << " sorted upserts into the loaded map" << std::endl;
+  bench::report("s21::Map insert_or_assign loop",
+                run_upsert_loop(items, updates), kUpdates);
+  bench::report("s21::Map upsert_sorted", run_upsert_sorted(items, updates),
+                kUpdates);
+  return 0;
+}
@@ -0,0 +1,73 @@
+#include <algorithm>
+#include <map>
+#include <random>
+#include <string>
+
+#include "../lib/s21_map.h"
+#include "../lib/s21_vector.h"
+#include "bench_utils.h"
+
+namespace {
+const std::size_t kKeys = 1000000;
+
+s21::Vector<std::string> make_keys(std::size_t count) {
+  s21::Vector<std::string> keys(count);
+  std::mt19937_64 rng(42);
+  for (std::string &key : keys) {
+    key = "session:" + std::to_string(rng());
+  }
+  return keys;
+}
+
+template <typename MapType>
+double run_subscript(const s21::Vector<std::string> &keys) {
+  bench::Timer timer;
+  MapType map;
+  for (const std::string &key : keys) map[key] = key;
+  for (const std::string &key : keys) map[key] += 'x';
+  bench::do_not_optimize(map.size());
+  return timer.seconds();
+}
+
+template <typename MapType>
+double run_try_emplace(const s21::Vector<std::string> &keys) {
+  bench::Timer timer;
+  MapType map;
+  for (const std::string &key : keys) map.try_emplace(key, key);
+  for (const std::string &key : keys) map.try_emplace(key, key);
+  bench::do_not_optimize(map.size());
+  return timer.seconds();
+}
+
+template <typename MapType>
+double run_hinted(const s21::Vector<std::string> &sorted) {
+  bench::Timer timer;
+  MapType map;
+  for (const std::string &key : sorted) map.emplace_hint(map.end(), key, key);
+  bench::do_not_optimize(map.size());
+  return timer.seconds();
+}
+}  // namespace
+
+int main() {
+  s21::Vector<std::string> keys = make_keys(kKeys);
+  s21::Vector<std::string> sorted = keys;
+  std::sort(sorted.begin(), sorted.end());
+  using S21Map = s21::Map<std::string, std::string>;
+  using StdMap = std::map<std::string, std::string>;
+  std::cout << "Map<std::string, std::string>, " << kKeys
+            << " keys, insert then update" << std::endl;
+  bench::report("s21::Map operator[]", run_subscript<S21Map>(keys),
+                2 * kKeys);
+  bench::report("std::map operator[]", run_subscript<StdMap>(keys),
+                2 * kKeys);
+  bench::report("s21::Map try_emplace", run_try_emplace<S21Map>(keys),
+                2 * kKeys);
+  bench::report("std::map try_emplace", run_try_emplace<StdMap>(keys),
+                2 * kKeys);
+  bench::report("s21::Map emplace_hint(end), sorted",
+                run_hinted<S21Map>(sorted), kKeys);
+  bench::report("std::map emplace_hint(end), sorted",
+                run_hinted<StdMap>(sorted), kKeys);
+  return 0;
+}
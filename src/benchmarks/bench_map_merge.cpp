@@ -0,0 +1,66 @@
+#include <cstdint>
+#include <map>
+#include <random>
+
+#include "../lib/s21_map.h"
+#include "../lib/s21_vector.h"
+#include "bench_utils.h"
+
+namespace {
+const std::size_t kKeys = 1000000;
+const std::size_t kSmall = 1000;
+
+s21::Vector<std::uint64_t> make_keys(std::size_t count, std::uint64_t seed) {
+  s21::Vector<std::uint64_t> keys(count);
+  std::mt19937_64 rng(seed);
+  for (std::uint64_t &key : keys) key = rng() % (4 * kKeys);
+  return keys;
+}
+
+template <typename MapType>
+double run_merge(const s21::Vector<std::uint64_t> &mine,
+                 const s21::Vector<std::uint64_t> &theirs) {
+  MapType a;
+  MapType b;
+  for (std::uint64_t key : mine) a.insert({key, key});
+  for (std::uint64_t key : theirs) b.insert({key, key});
+  bench::Timer timer;
+  a.merge(b);
+  bench::do_not_optimize(a.size() + b.size());
+  return timer.seconds();
+}
+
+template <typename MapType>
+double run_extract_insert(const s21::Vector<std::uint64_t> &keys) {
+  MapType a;
+  MapType b;
+  for (std::uint64_t key : keys) a.insert({key, key});
+  bench::Timer timer;
+  for (std::uint64_t key : keys) b.insert(a.extract(key));
+  bench::do_not_optimize(b.size());
+  return timer.seconds();
+}
+}  // namespace
+
+int main() {
+  s21::Vector<std::uint64_t> mine = make_keys(kKeys, 1);
+  s21::Vector<std::uint64_t> theirs = make_keys(kKeys, 2);
+  s21::Vector<std::uint64_t> few = make_keys(kSmall, 3);
+  using S21Map = s21::Map<std::uint64_t, std::uint64_t>;
+  using StdMap = std::map<std::uint64_t, std::uint64_t>;
+  std::cout << "Map<uint64_t, uint64_t>, merge of two ~" << kKeys
+            << "-key maps" << std::endl;
+  bench::report("s21::Map merge", run_merge<S21Map>(mine, theirs), kKeys);
+  bench::report("std::map merge", run_merge<StdMap>(mine, theirs), kKeys);
+  std::cout << "merge of " << kSmall << " keys into the large map"
+            << std::endl;
+  bench::report("s21::Map merge", run_merge<S21Map>(mine, few), kSmall);
+  bench::report("std::map merge", run_merge<StdMap>(mine, few), kSmall);
+  std::cout << "extract then insert node handles, " << kKeys << " keys"
+            << std::endl;
+  bench::report("s21::Map extract/insert", run_extract_insert<S21Map>(mine),
+                kKeys);
+  bench::report("std::map extract/insert", run_extract_insert<StdMap>(mine),
+                kKeys);
+  return 0;
+}
@@ -0,0 +1,79 @@
+#include <cstdio>
+#include <map>
+#include <string>
+
+#include "../lib/s21_map.h"
+#include "../lib/s21_vector.h"
+#include "bench_utils.h"
+
+namespace {
+const std::size_t kKeys = 10000000;
+
+using S21Map = s21::Map<std::string, int>;
+using Node = S21Map::node_type;
+
+// Successor search as iterators did it before the in-order links: descend
+// into the right subtree or climb while the parent's key is smaller.
+Node *climbing_next(Node *node) {
+  if (node->right) {
+    node = node->right;
+    while (node->left) node = node->left;
+    return node;
+  }
+  while (node->parent && node->parent->key_.first < node->key_.first) {
+    node = node->parent;
+  }
+  return node->parent;
+}
+
+s21::Vector<std::string> make_sorted_keys() {
+  s21::Vector<std::string> keys(kKeys);
+  char buffer[32];
+  for (std::size_t i = 0; i < kKeys; ++i) {
+    std::snprintf(buffer, sizeof(buffer), "user:%012zu", i);
+    keys[i] = buffer;
+  }
+  return keys;
+}
+
+template <typename Iterator>
+std::size_t scan(Iterator first, Iterator last) {
+  std::size_t checksum = 0;
+  for (; first != last; ++first) checksum += (*first).first.size();
+  return checksum;
+}
+}  // namespace
+
+int main() {
+  s21::Vector<std::string> keys = make_sorted_keys();
+  std::cout << "Full scan of " << kKeys << " std::string keys" << std::endl;
+  {
+    S21Map map;
+    for (std::size_t i = 0; i < kKeys; ++i) {
+      map.emplace_hint(map.end(), keys[i], static_cast<int>(i));
+    }
+    bench::Timer linked;
+    bench::do_not_optimize(scan(map.begin(), map.end()));
+    bench::report("s21::Map threaded ++", linked.seconds(), kKeys);
+
+    bench::Timer climbing;
+    std::size_t checksum = 0;
+    for (Node *node = map.begin().iterated_node_; node;
+         node = climbing_next(node)) {
+      checksum += node->key_.first.size();
+    }
+    bench::do_not_optimize(checksum);
+    bench::report("s21::Map parent climbing with compares",
+                  climbing.seconds(), kKeys);
+  }
+  {
+    std::map<std::string, int> map;
+    for (std::size_t i = 0; i < kKeys; ++i) {
+      map.emplace_hint(map.end(), keys[i], static_cast<int>(i));
+    }
+    bench::Timer timer;
+    bench::do_not_optimize(scan(map.begin(), map.end()));
+    bench::report("std::map ++", timer.seconds(), kKeys);
+  }
+  return 0;
+}
@@ -0,0 +1,66 @@
+#include <cstdint>
+#include <random>
+
+#include "../lib/s21_map.h"
+#include "../lib/s21_persistent_tree.h"
+#include "../lib/s21_vector.h"
+#include "bench_utils.h"
+
+namespace {
+const std::size_t kKeys = 1000000;
+const std::size_t kWrites = 200000;
+const std::size_t kWritesPerSnapshot = 20000;
+
+s21::Vector<std::uint64_t> make_keys(std::size_t count, std::uint64_t seed) {
+  s21::Vector<std::uint64_t> keys(count);
+  std::mt19937_64 rng(seed);
+  for (std::uint64_t &key : keys) key = rng() % (4 * kKeys);
+  return keys;
+}
+
+// Overwrites kWrites keys and takes a copy of the map every
+// kWritesPerSnapshot of them, as a writer feeding analytics readers would.
+template <typename MapType, typename TakeCopy>
+double run_writer(const s21::Vector<std::uint64_t> &keys,
+                  const s21::Vector<std::uint64_t> &writes,
+                  TakeCopy take_copy) {
+  MapType map;
+  for (std::uint64_t key : keys) map.insert(key, key);
+  bench::Timer timer;
+  for (std::size_t i = 0; i < writes.size(); ++i) {
+    if (i % kWritesPerSnapshot == 0) {
+      auto copy = take_copy(map);
+      bench::do_not_optimize(copy.size());
+    }
+    map.insert_or_assign(writes[i], i);
+  }
+  bench::do_not_optimize(map.size());
+  return timer.seconds();
+}
+}  // namespace
+
+int main() {
+  s21::Vector<std::uint64_t> keys = make_keys(kKeys, 1);
+  s21::Vector<std::uint64_t> writes = make_keys(kWrites, 2);
+  using S21Map = s21::Map<std::uint64_t, std::uint64_t>;
+  using Persistent = s21::PersistentMap<std::uint64_t, std::uint64_t>;
+  std::cout << "Map<uint64_t, uint64_t> with ~" << kKeys << " keys, "
+            << kWrites << " writes, a copy every " << kWritesPerSnapshot
+            << std::endl;
+  bench::report("s21::Map copy constructor",
+                run_writer<S21Map>(keys, writes,
+                                   [](const S21Map &map) { return map; }),
+                kWrites);
+  bench::report(
+      "s21::PersistentMap snapshot",
+      run_writer<Persistent>(
+          keys, writes, [](const Persistent &map) { return map.snapshot(); }),
+      kWrites);
+  bench::report("s21::PersistentMap, no snapshots",
+                run_writer<Persistent>(keys, writes,
+                                       [](const Persistent &) {
+                                         return Persistent::snapshot_type();
+                                       }),
+                kWrites);
+  return 0;
+}
@@ -0,0 +1,68 @@
+#include <cstdint>
+#include <map>
+
+#include "../lib/s21_map.h"
+#include "bench_utils.h"
+
+namespace {
+const std::uint64_t kEvents = 2000000;
+const std::uint64_t kStep = 200000;
+
+template <typename MapType>
+void fill(MapType &map) {
+  for (std::uint64_t t = 0; t < kEvents; ++t) map.insert({t, t});
+}
+
+// Drops everything older than a moving cutoff, kStep events at a time.
+template <typename MapType>
+double run_range_erase() {
+  MapType map;
+  fill(map);
+  bench::Timer timer;
+  for (std::uint64_t cutoff = kStep; cutoff <= kEvents; cutoff += kStep) {
+    map.erase(map.begin(), map.lower_bound(cutoff));
+  }
+  bench::do_not_optimize(map.size());
+  return timer.seconds();
+}
+
+double run_one_by_one() {
+  s21::Map<std::uint64_t, std::uint64_t> map;
+  fill(map);
+  bench::Timer timer;
+  for (std::uint64_t cutoff = kStep; cutoff <= kEvents; cutoff += kStep) {
+    while (!map.empty() && (*map.begin()).first < cutoff) {
+      map.erase(map.begin());
+    }
+  }
+  bench::do_not_optimize(map.size());
+  return timer.seconds();
+}
+
+double run_extract_range() {
+  s21::Map<std::uint64_t, std::uint64_t> map;
+  fill(map);
+  bench::Timer timer;
+  std::size_t moved = 0;
+  for (std::uint64_t cutoff = kStep; cutoff <= kEvents; cutoff += kStep) {
+    moved += map.extract_range(cutoff - kStep, cutoff).size();
+  }
+  bench::do_not_optimize(moved);
+  return timer.seconds();
+}
+}  // namespace
+
+int main() {
+  using S21Map = s21::Map<std::uint64_t, std::uint64_t>;
+  using StdMap = std::map<std::uint64_t, std::uint64_t>;
+  std::cout << "Map<uint64_t, uint64_t>, " << kEvents
+            << " timestamps truncated " << kStep << " at a time" << std::endl;
+  bench::report("s21::Map erase one by one", run_one_by_one(), kEvents);
+  bench::report("s21::Map erase(first, last)", run_range_erase<S21Map>(),
+                kEvents);
+  bench::report("std::map erase(first, last)", run_range_erase<StdMap>(),
+                kEvents);
+  bench::report("s21::Map extract_range", run_extract_range(),
+                kEvents);
+  return 0;
+}
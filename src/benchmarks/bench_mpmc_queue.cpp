@@ -0,0 +1,63 @@
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../lib/s21_mpmc_queue.h"
+#include "../lib/s21_queue.h"
+#include "bench_utils.h"
+
+namespace {
+const std::size_t kOperations = 1 << 20;
+
+class LockedQueue {
+ public:
+  void push(int value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    queue_.push(value);
+  }
+
+  void pop(int &value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    value = queue_.front();
+    queue_.pop();
+  }
+
+ private:
+  std::mutex mutex_;
+  s21::Queue<int> queue_;
+};
+
+// Every thread alternates push and pop, so the queue never runs dry and the
+// workload is the same for any number of threads.
+template <typename Queue>
+double run(Queue &queue, int threads) {
+  std::vector<std::thread> workers;
+  bench::Timer timer;
+  for (int t = 0; t < threads; ++t) {
+    workers.emplace_back([&queue, threads] {
+      int value = 0;
+      for (std::size_t i = 0; i < kOperations / threads; ++i) {
+        queue.push(static_cast<int>(i));
+        queue.pop(value);
+      }
+      bench::do_not_optimize(value);
+    });
+  }
+  for (auto &worker : workers) worker.join();
+  return timer.seconds();
+}
+}  // namespace
+
+int main() {
+  std::cout << "MpmcQueue vs mutex + s21::Queue, " << kOperations
+            << " push/pop pairs" << std::endl;
+  for (int threads = 1; threads <= 64; threads *= 2) {
+    std::string suffix = " threads=" + std::to_string(threads);
+    s21::MpmcQueue<int> mpmc(1024);
+    bench::report("MpmcQueue" + suffix, run(mpmc, threads), 2 * kOperations);
+    LockedQueue locked;
+    bench::report("mutex + Queue" + suffix, run(locked, threads),
+                  2 * kOperations);
+  }
+  return 0;
+}
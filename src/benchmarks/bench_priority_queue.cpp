@@ -0,0 +1,44 @@
+#include <functional>
+#include <queue>
+#include <random>
+
+#include "../lib/s21_priority_queue.h"
+#include "bench_utils.h"
+
+namespace {
+const std::size_t kItems = 10000000;
+
+template <typename Queue>
+double run(const s21::Vector<int> &keys) {
+  Queue queue;
+  bench::Timer timer;
+  for (int key : keys) queue.push(key);
+  long long checksum = 0;
+  while (!queue.empty()) {
+    checksum += queue.top();
+    queue.pop();
+  }
+  bench::do_not_optimize(checksum);
+  return timer.seconds();
+}
+
+template <std::size_t Arity>
+using MinHeap =
+    s21::PriorityQueue<int, s21::Vector<int>, std::greater<int>, Arity>;
+}  // namespace
+
+int main() {
+  s21::Vector<int> keys(kItems);
+  std::mt19937 rng(42);
+  for (int &key : keys) key = static_cast<int>(rng());
+  std::cout << "PriorityQueue, " << kItems << " pushes then pops"
+            << std::endl;
+  bench::report("PriorityQueue arity=2", run<MinHeap<2>>(keys), 2 * kItems);
+  bench::report("PriorityQueue arity=4", run<MinHeap<4>>(keys), 2 * kItems);
+  bench::report("PriorityQueue arity=8", run<MinHeap<8>>(keys), 2 * kItems);
+  bench::report("std::priority_queue",
+                run<std::priority_queue<int, std::vector<int>,
+                                        std::greater<int>>>(keys),
+                2 * kItems);
+  return 0;
+}
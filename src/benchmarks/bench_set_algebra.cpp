@@ -0,0 +1,79 @@
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+
+#include "../lib/s21_parallel_tree.h"
+#include "../lib/s21_set.h"
+#include "../lib/s21_vector.h"
+#include "bench_utils.h"
+
+namespace {
+const std::size_t kLarge = 2000000;
+
+using KeySet = s21::Set<std::uint64_t>;
+
+s21::Vector<std::uint64_t> make_sorted(std::size_t count, std::uint64_t seed) {
+  s21::Vector<std::uint64_t> keys(count);
+  std::mt19937_64 rng(seed);
+  for (std::uint64_t &key : keys) key = rng() % (4 * kLarge);
+  std::sort(keys.begin(), keys.end());
+  return keys;
+}
+
+// The old way: walk the smaller set and probe the larger one.
+double run_probe(const s21::Vector<std::uint64_t> &large,
+                 const s21::Vector<std::uint64_t> &small) {
+  KeySet a(large.begin(), large.end());
+  KeySet b(small.begin(), small.end());
+  bench::Timer timer;
+  KeySet result;
+  for (auto it = b.begin(); it != b.end(); ++it) {
+    if (a.contains((*it).first)) result.insert((*it).first);
+  }
+  bench::do_not_optimize(result.size());
+  return timer.seconds();
+}
+
+double run_join(const s21::Vector<std::uint64_t> &large,
+                const s21::Vector<std::uint64_t> &small, bool intersect,
+                s21::TaskScheduler *scheduler) {
+  KeySet a(large.begin(), large.end());
+  KeySet b(small.begin(), small.end());
+  bench::Timer timer;
+  if (intersect) {
+    b.set_intersection(a);
+  } else if (scheduler) {
+    a.set_union(b, s21::ParallelFork(*scheduler));
+  } else {
+    a.set_union(b);
+  }
+  double seconds = timer.seconds();
+  bench::do_not_optimize(a.size() + b.size());
+  return seconds;
+}
+}  // namespace
+
+int main() {
+  s21::Vector<std::uint64_t> large = make_sorted(kLarge, 1);
+  std::cout << "Set<uint64_t> of " << kLarge << " keys against smaller sets ("
+            << std::thread::hardware_concurrency() << " hardware threads)"
+            << std::endl;
+  for (std::size_t small_size : {kLarge / 100, kLarge / 10, kLarge}) {
+    s21::Vector<std::uint64_t> small = make_sorted(small_size, 2);
+    std::string suffix = ", m = " + std::to_string(small_size);
+    bench::report("probe intersection" + suffix, run_probe(large, small),
+                  small_size);
+    bench::report("join intersection, frees both" + suffix,
+                  run_join(large, small, true, nullptr), small_size);
+    bench::report("join union" + suffix,
+                  run_join(large, small, false, nullptr), small_size);
+    for (std::size_t threads : {1, 2, 4}) {
+      s21::TaskScheduler scheduler(threads);
+      bench::report("join union, " + std::to_string(threads) + " workers" +
+                        suffix,
+                    run_join(large, small, false, &scheduler), small_size);
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,89 @@
+#include <cstdint>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../lib/s21_concurrent_skip_list.h"
+#include "../lib/s21_map.h"
+#include "bench_utils.h"
+
+namespace {
+const std::size_t kKeys = 1 << 16;
+const std::size_t kOpsPerThread = 200000;
+
+// The ordered container guarded by one mutex that this list replaces.
+class LockedMap {
+ public:
+  bool contains(std::uint64_t key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return map_.contains(key);
+  }
+
+  bool insert(std::uint64_t key, std::uint64_t value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return map_.insert(key, value).second;
+  }
+
+  bool erase(std::uint64_t key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = map_.find(key);
+    if (it == map_.end()) return false;
+    map_.erase(it);
+    return true;
+  }
+
+ private:
+  std::mutex mutex_;
+  s21::Map<std::uint64_t, std::uint64_t> map_;
+};
+
+// Read-mostly: write_percent of operations insert or erase, half each.
+template <typename MapType>
+double run_mixed(MapType &map, int threads, unsigned write_percent) {
+  for (std::uint64_t key = 0; key < kKeys; key += 2) map.insert(key, key);
+  std::vector<std::thread> workers;
+  bench::Timer timer;
+  for (int t = 0; t < threads; ++t) {
+    workers.emplace_back([&map, t, write_percent] {
+      std::mt19937_64 rng(t + 1);
+      std::size_t hits = 0;
+      for (std::size_t i = 0; i < kOpsPerThread; ++i) {
+        std::uint64_t key = rng() % kKeys;
+        unsigned roll = rng() % 100;
+        if (roll >= write_percent) {
+          hits += map.contains(key);
+        } else if (roll % 2) {
+          map.insert(key, i);
+        } else {
+          map.erase(key);
+        }
+      }
+      bench::do_not_optimize(hits);
+    });
+  }
+  for (std::thread &worker : workers) worker.join();
+  return timer.seconds();
+}
+}  // namespace
+
+int main() {
+  using SkipList = s21::ConcurrentSkipListMap<std::uint64_t, std::uint64_t>;
+  std::cout << "ordered map of uint64_t, " << kKeys << " keys, "
+            << kOpsPerThread << " operations per thread" << std::endl;
+  for (unsigned write_percent : {2u, 20u}) {
+    for (int threads : {1, 2, 4, 8}) {
+      std::string suffix = ", " + std::to_string(write_percent) +
+                           "% writes, " + std::to_string(threads) + " thr";
+      std::size_t ops = kOpsPerThread * threads;
+      LockedMap locked;
+      bench::report("mutex Map" + suffix,
+                    run_mixed(locked, threads, write_percent), ops);
+      SkipList skip_list;
+      bench::report("s21::ConcurrentSkipListMap" + suffix,
+                    run_mixed(skip_list, threads, write_percent), ops);
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,77 @@
+#include <cstdint>
+#include <random>
+#include <utility>
+
+#include "../lib/s21_map.h"
+#include "../lib/s21_timer_wheel.h"
+#include "bench_utils.h"
+
+namespace {
+// Connection idle timeouts: every operation is one connection seeing traffic
+// (its deadline moves forward) followed by a one-tick clock advance.
+const int kConnections = 10000;
+const int kOperations = 40000;
+const std::uint64_t kTimeout = 30000;
+
+double run_wheel(const s21::Vector<int> &activity, std::uint64_t &expired) {
+  bench::Timer timer;
+  s21::TimerWheel<int> wheel;
+  s21::Vector<s21::TimerWheel<int>::handle_type> handles(kConnections);
+  for (int id = 0; id < kConnections; ++id) {
+    handles[id] = wheel.schedule(kTimeout + id, id);
+  }
+  for (int id : activity) {
+    if (!wheel.reschedule(handles[id], wheel.now() + kTimeout)) {
+      handles[id] = wheel.schedule(wheel.now() + kTimeout, id);
+    }
+    expired += wheel.advance(wheel.now() + 1, [](int) {});
+  }
+  return timer.seconds();
+}
+
+// The same schedule kept in an ordered map keyed by (deadline, id).
+double run_map(const s21::Vector<int> &activity, std::uint64_t &expired) {
+  using Key = std::pair<std::uint64_t, int>;
+  bench::Timer timer;
+  s21::Map<Key, int> deadlines;
+  s21::Vector<std::uint64_t> deadline_of(kConnections);
+  s21::Vector<bool> alive(kConnections);
+  for (int id = 0; id < kConnections; ++id) {
+    deadline_of[id] = kTimeout + id;
+    alive[id] = true;
+    deadlines.insert({Key{deadline_of[id], id}, id});
+  }
+  std::uint64_t now = 0;
+  for (int id : activity) {
+    if (alive[id]) {
+      deadlines.erase(deadlines.insert({Key{deadline_of[id], id}, id}).first);
+    }
+    deadline_of[id] = now + kTimeout;
+    alive[id] = true;
+    deadlines.insert({Key{deadline_of[id], id}, id});
+    ++now;
+    while (!deadlines.empty() && (*deadlines.begin()).first.first <= now) {
+      alive[(*deadlines.begin()).second] = false;
+      deadlines.erase(deadlines.begin());
+      ++expired;
+    }
+  }
+  return timer.seconds();
+}
+}  // namespace
+
+int main() {
+  s21::Vector<int> activity(kOperations);
+  std::mt19937 rng(42);
+  for (int &id : activity) id = static_cast<int>(rng() % kConnections);
+  std::uint64_t wheel_expired = 0;
+  std::uint64_t map_expired = 0;
+  std::cout << "Idle timeouts, " << kConnections << " connections, "
+            << kOperations << " touches" << std::endl;
+  bench::report("TimerWheel reschedule + advance",
+                run_wheel(activity, wheel_expired), kOperations);
+  bench::report("Map<(deadline, id)> erase + insert",
+                run_map(activity, map_expired), kOperations);
+  bench::do_not_optimize(wheel_expired + map_expired);
+  return 0;
+}
@@ -0,0 +1,39 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_BENCHMARKS_BENCH_UTILS_H
+#define CPP2_S21_CONTAINERS_SRC_BENCHMARKS_BENCH_UTILS_H
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+namespace bench {
+class Timer {
+ public:
+  Timer() : start_(std::chrono::steady_clock::now()) {}
+
+  double seconds() const {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                         start_)
+        .count();
+  }
+
+ private:
+  std::chrono::steady_clock::time_point start_;
+};
+
+inline void report(const std::string &name, double seconds,
+                   std::size_t operations) {
+  std::cout << std::left << std::setw(44) << name << std::right
+            << std::setw(10) << std::fixed << std::setprecision(3)
+            << seconds * 1000 << " ms" << std::setw(12)
+            << std::setprecision(2) << operations / seconds / 1e6
+            << " Mops/s" << std::endl;
+}
+
+template <typename T>
+inline void do_not_optimize(const T &value) {
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+}  // namespace bench
+
+#endif  // CPP2_S21_CONTAINERS_SRC_BENCHMARKS_BENCH_UTILS_H
@@ -0,0 +1,59 @@
+#include <random>
+
+#include "../lib/s21_multiset.h"
+#include "../lib/s21_vector.h"
+#include "../lib/s21_window_quantile.h"
+#include "bench_utils.h"
+
+namespace {
+const std::size_t kWindow = 1000000;
+const std::size_t kSlides = 1000000;
+const std::size_t kWalkQueries = 20;
+
+s21::Vector<int> make_samples(std::size_t count) {
+  s21::Vector<int> samples(count);
+  std::mt19937 rng(42);
+  std::lognormal_distribution<double> latency(3.0, 1.0);
+  for (int &sample : samples) sample = static_cast<int>(latency(rng) * 1000);
+  return samples;
+}
+
+// Slides the window by one sample and asks for p50 and p99 every time.
+double run_window(const s21::Vector<int> &samples) {
+  s21::WindowQuantile<int> window(kWindow);
+  window.push_many(samples.begin(), samples.begin() + kWindow);
+  long long checksum = 0;
+  bench::Timer timer;
+  for (std::size_t i = kWindow; i < samples.size(); ++i) {
+    window.push(samples[i]);
+    checksum += window.median() + window.quantile(0.99);
+  }
+  bench::do_not_optimize(checksum);
+  return timer.seconds();
+}
+
+// The previous approach: one Multiset, quantiles found by walking it.
+double run_walk(const s21::Vector<int> &samples) {
+  s21::Multiset<int> sorted;
+  for (std::size_t i = 0; i < kWindow; ++i) sorted.insert(samples[i]);
+  long long checksum = 0;
+  bench::Timer timer;
+  for (std::size_t q = 0; q < kWalkQueries; ++q) {
+    std::size_t target = sorted.size() * 99 / 100;
+    auto it = sorted.begin();
+    for (std::size_t i = 0; i < target; ++i) ++it;
+    checksum += *it;
+  }
+  bench::do_not_optimize(checksum);
+  return timer.seconds();
+}
+}  // namespace
+
+int main() {
+  s21::Vector<int> samples = make_samples(kWindow + kSlides);
+  std::cout << "Window of " << kWindow << " samples" << std::endl;
+  bench::report("WindowQuantile push + p50 + p99", run_window(samples),
+                kSlides);
+  bench::report("Multiset walk to p99", run_walk(samples), kWalkQueries);
+  return 0;
+}
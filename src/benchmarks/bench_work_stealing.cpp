@@ -0,0 +1,162 @@
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../lib/s21_queue.h"
+#include "../lib/s21_task_scheduler.h"
+#include "bench_utils.h"
+
+namespace {
+const int kFib = 32;
+const int kFibCutoff = 16;
+const std::size_t kElements = 1 << 22;
+
+// The baseline: one mutex-protected s21::Queue shared by every worker.
+class SharedQueuePool {
+ public:
+  struct Group {
+    std::atomic<int> pending{0};
+  };
+
+  explicit SharedQueuePool(std::size_t threads) : stop_(false) {
+    for (std::size_t i = 0; i < threads; ++i) {
+      workers_.emplace_back([this] {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (!stop_) {
+          if (queue_.empty()) {
+            cv_.wait(lock);
+            continue;
+          }
+          run_locked(lock);
+        }
+      });
+    }
+  }
+
+  ~SharedQueuePool() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    cv_.notify_all();
+    for (auto &worker : workers_) worker.join();
+  }
+
+  void spawn(Group &group, std::function<void()> body) {
+    group.pending.fetch_add(1);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      queue_.push(Task{std::move(body), &group});
+    }
+    cv_.notify_one();
+  }
+
+  void sync(Group &group) {
+    while (group.pending.load() != 0) {
+      std::unique_lock<std::mutex> lock(mutex_);
+      if (queue_.empty()) {
+        lock.unlock();
+        std::this_thread::yield();
+      } else {
+        run_locked(lock);
+      }
+    }
+  }
+
+ private:
+  struct Task {
+    std::function<void()> body;
+    Group *group;
+  };
+
+  void run_locked(std::unique_lock<std::mutex> &lock) {
+    Task task = std::move(queue_.front());
+    queue_.pop();
+    lock.unlock();
+    task.body();
+    task.group->pending.fetch_sub(1);
+    lock.lock();
+  }
+
+  bool stop_;
+  s21::Queue<Task> queue_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::vector<std::thread> workers_;
+};
+
+long long fib_serial(int n) {
+  return n < 2 ? n : fib_serial(n - 1) + fib_serial(n - 2);
+}
+
+long long fib(s21::TaskScheduler &scheduler, int n) {
+  if (n < kFibCutoff) return fib_serial(n);
+  long long a = 0;
+  s21::TaskGroup group(scheduler);
+  group.spawn([&] { a = fib(scheduler, n - 1); });
+  long long b = fib(scheduler, n - 2);
+  group.sync();
+  return a + b;
+}
+
+long long fib(SharedQueuePool &pool, int n) {
+  if (n < kFibCutoff) return fib_serial(n);
+  long long a = 0;
+  SharedQueuePool::Group group;
+  pool.spawn(group, [&] { a = fib(pool, n - 1); });
+  long long b = fib(pool, n - 2);
+  pool.sync(group);
+  return a + b;
+}
+
+void for_shared(SharedQueuePool &pool, SharedQueuePool::Group &group,
+                std::size_t first, std::size_t last,
+                const std::function<void(std::size_t)> &body) {
+  while (last - first > 1024) {
+    std::size_t middle = first + (last - first) / 2;
+    pool.spawn(group, [&pool, &group, middle, last, &body] {
+      for_shared(pool, group, middle, last, body);
+    });
+    last = middle;
+  }
+  for (; first < last; ++first) body(first);
+}
+}  // namespace
+
+int main() {
+  std::size_t threads = s21::TaskScheduler::default_threads();
+  std::cout << "Work stealing vs shared queue, " << threads << " workers"
+            << std::endl;
+  s21::Vector<double> data(kElements);
+  for (double &x : data) x = 1.0;
+  std::function<void(std::size_t)> body = [&data](std::size_t i) {
+    data[i] = data[i] * 0.5 + 1.0;
+  };
+  {
+    s21::TaskScheduler scheduler(threads);
+    bench::Timer timer;
+    long long leaves = fib(scheduler, kFib);
+    bench::report("fib(32) TaskScheduler", timer.seconds(), leaves);
+    bench::Timer loop;
+    s21::parallel_for(scheduler, std::size_t{0}, data.size(), std::size_t{1024},
+                      body);
+    bench::report("parallel_for Vector TaskScheduler", loop.seconds(),
+                  kElements);
+  }
+  {
+    SharedQueuePool pool(threads);
+    bench::Timer timer;
+    long long leaves = fib(pool, kFib);
+    bench::report("fib(32) shared Queue", timer.seconds(), leaves);
+    bench::Timer loop;
+    SharedQueuePool::Group group;
+    for_shared(pool, group, 0, data.size(), body);
+    pool.sync(group);
+    bench::report("parallel_for Vector shared Queue", loop.seconds(),
+                  kElements);
+  }
+  return 0;
+}
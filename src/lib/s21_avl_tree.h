@@ -1,23 +1,175 @@
 #ifndef CPP2_S21_CONTAINERS_SRC_S21_AVL_TREE_H_
 #define CPP2_S21_CONTAINERS_SRC_S21_AVL_TREE_H_
 
+#include <algorithm>
+#include <functional>
 #include <initializer_list>
 #include <limits>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_vector.h"
 
 using namespace std;
 
+// Half-open run of iterators returned by the containers' range(lo, hi).
+template <typename Iterator>
+class TreeRange {
+ public:
+  TreeRange(Iterator first, Iterator last) : first_(first), last_(last) {}
+  Iterator begin() const { return first_; }
+  Iterator end() const { return last_; }
+  bool empty() const { return first_ == last_; }
+
+ private:
+  Iterator first_;
+  Iterator last_;
+};
+
+// In-order run of a tree that knows how many elements it holds, so slices
+// can be walked on separate threads and their output placed in order.
+template <typename Iterator>
+class TreeSlice {
+ public:
+  TreeSlice() : first_(), last_(), size_(0) {}
+  TreeSlice(Iterator first, Iterator last, std::size_t size)
+      : first_(first), last_(last), size_(size) {}
+  Iterator begin() const { return first_; }
+  Iterator end() const { return last_; }
+  std::size_t size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+
+ private:
+  Iterator first_;
+  Iterator last_;
+  std::size_t size_;
+};
+
+// Owns a node taken out of a tree by extract(). Inserting it into a
+// container relinks the node without allocating; a node still held when the
+// handle goes away is freed.
+template <typename Node, bool kMapped>
+class TreeNodeHandle {
+ public:
+  TreeNodeHandle() noexcept : node_(nullptr) {}
+  explicit TreeNodeHandle(Node *node) noexcept : node_(node) {}
+  TreeNodeHandle(TreeNodeHandle &&other) noexcept : node_(other.release()) {}
+  TreeNodeHandle(const TreeNodeHandle &) = delete;
+  TreeNodeHandle &operator=(const TreeNodeHandle &) = delete;
+
+  TreeNodeHandle &operator=(TreeNodeHandle &&other) noexcept {
+    if (this != &other) {
+      delete node_;
+      node_ = other.release();
+    }
+    return *this;
+  }
+
+  ~TreeNodeHandle() { delete node_; }
+
+  bool empty() const noexcept { return node_ == nullptr; }
+  explicit operator bool() const noexcept { return node_ != nullptr; }
+
+  decltype(auto) key() const { return (node_->key_.first); }
+
+  template <bool M = kMapped, typename = std::enable_if_t<M>>
+  auto &mapped() const {
+    return node_->key_.second;
+  }
+
+  decltype(auto) value() const {
+    if constexpr (kMapped) {
+      return (node_->key_);
+    } else {
+      return (node_->key_.first);
+    }
+  }
+
+  Node *get() const noexcept { return node_; }
+
+  Node *release() noexcept {
+    Node *node = node_;
+    node_ = nullptr;
+    return node;
+  }
+
+ private:
+  Node *node_;
+};
+
+// Result of inserting a node handle: where the key lives and, if it was
+// already there, the handle given back untouched.
+template <typename Iterator, typename NodeHandle>
+struct TreeInsertReturn {
+  Iterator position;
+  bool inserted;
+  NodeHandle node;
+};
+
 template <typename Key, typename T>
 struct node {
-  node() : key_{}, height{}, left{}, right{}, parent{} {}
-  node(Key key, int height_)
-      : key_{key}, height{height_}, left{}, right{}, parent{} {}
+  node()
+      : key_{},
+        height{},
+        weight{},
+        left{},
+        right{},
+        parent{},
+        next{},
+        prev{} {}
+  node(const Key &key, int height_)
+      : key_{key},
+        height{height_},
+        weight{},
+        left{},
+        right{},
+        parent{},
+        next{},
+        prev{} {}
+  template <typename... Args>
+  explicit node(std::in_place_t, Args &&...args)
+      : key_(std::forward<Args>(args)...),
+        height{},
+        weight{},
+        left{},
+        right{},
+        parent{},
+        next{},
+        prev{} {}
   Key key_;
   int height;
+  // Total Weight of the subtree rooted here, for rank and select.
+  std::size_t weight;
   node *left, *right, *parent;
+  // In-order neighbours, so iteration never searches or compares keys.
+  node *next, *prev;
 };
 
-template <typename Key, typename T>
-class AVL {
+// Every element counts once. Containers that fold duplicates into one node
+// pass a policy returning the duplicate count instead.
+struct UnitWeight {
+  template <typename Key>
+  std::size_t operator()(const Key &) const noexcept {
+    return 1;
+  }
+};
+
+// Fork policy for AVL::combine_with that runs both halves in turn on the
+// calling thread.
+struct SequentialFork {
+  template <typename Less, typename Greater>
+  void operator()(Less &less, Greater &greater) const {
+    less();
+    greater();
+  }
+};
+
+// Compare orders the first members of Key. It is stored as an empty base so
+// a stateless comparator adds nothing to the tree's size. Weight gives each
+// node's contribution to the subtree weights behind rank() and select().
+template <typename Key, typename T, typename Compare = std::less<>,
+          typename Weight = UnitWeight>
+class AVL : private Compare {
  public:
   class Iterator;
   class ConstIterator;
@@ -27,25 +179,29 @@ class AVL {
   using size_type = std::size_t;
   using iterator = Iterator;
   using const_iterator = ConstIterator;
+  using key_compare = Compare;
 
   // ---------------- Member functions ---------------------
 
   AVL() : root_(nullptr), size_(0) {}
+  explicit AVL(const Compare &comp) : Compare(comp), root_(nullptr), size_(0) {}
   ~AVL() { clear(); }
 
   explicit AVL(std::initializer_list<Key> const &init) : AVL() {
     for (auto i : init) insert(i);
   }
 
-  explicit AVL(const AVL<Key, T> &other) : root_{nullptr}, size_{other.size_} {
+  explicit AVL(const AVL &other)
+      : Compare(other), root_{nullptr}, size_{other.size_} {
     if (other.root_) {
-      root_ = new node_type(other.root_->key_, other.root_->height);
-      root_->parent = nullptr;
+      root_ = clone(other.root_);
       copy_tree(root_, other.root_);
+      thread();
     }
   }
 
-  AVL(AVL<Key, T> &&other) noexcept : root_(other.root_), size_(other.size_) {
+  AVL(AVL &&other) noexcept
+      : Compare(std::move(other)), root_(other.root_), size_(other.size_) {
     other.root_ = nullptr;
     other.size_ = 0;
   }
@@ -53,14 +209,19 @@ class AVL {
   AVL &operator=(const AVL &other) {
     if (this->root_ != other.root_) {
       clear();
-      size_ = other.size_;
-      root_ = new node_type(other.root_->key_, other.root_->height);
-      copy_tree(root_, other.root_);
+      static_cast<Compare &>(*this) = other;
+      if (other.root_) {
+        size_ = other.size_;
+        root_ = clone(other.root_);
+        copy_tree(root_, other.root_);
+        thread();
+      }
     }
     return *this;
   }
 
   AVL &operator=(AVL &&other) {
+    std::swap(static_cast<Compare &>(*this), static_cast<Compare &>(other));
     std::swap(root_, other.root_);
     std::swap(size_, other.size_);
     other.clear();
@@ -79,10 +240,140 @@ class AVL {
 
   // ---------------- Modifiers ---------------------
 
-  void erase(Key key) {
-    root_ = erases(root_, key);
-    make_parents(root_, nullptr);
-    size_--;
+  void erase(const Key &key) { erase_key(key.first); }
+
+  template <typename K>
+  bool erase_key(const K &key) {
+    node_type *found = find_key(key);
+    if (found) erase_node(found);
+    return found != nullptr;
+  }
+
+  // Unlinks and frees node, then rebalances from where the tree changed.
+  void erase_node(node_type *node) { delete extract_node(node); }
+
+  // Unlinks node without freeing it and returns it reset to a lone node that
+  // insert_node() accepts again.
+  node_type *extract_node(node_type *node) {
+    if (node->prev) node->prev->next = node->next;
+    if (node->next) node->next->prev = node->prev;
+    node_type *changed;
+    if (!node->left || !node->right) {
+      replace_child(node, node->left ? node->left : node->right);
+      changed = node->parent;
+    } else {
+      node_type *successor = node->next;
+      if (successor->parent != node) {
+        changed = successor->parent;
+        replace_child(successor, successor->right);
+        successor->right = node->right;
+        successor->right->parent = successor;
+      } else {
+        changed = successor;
+      }
+      replace_child(node, successor);
+      successor->left = node->left;
+      successor->left->parent = successor;
+    }
+    size_ -= Weight()(node->key_);
+    rebalance(changed);
+    node->left = node->right = node->parent = nullptr;
+    node->next = node->prev = nullptr;
+    update_height(node);
+    return node;
+  }
+
+  // Moves other's nodes here without allocating. A node whose key is
+  // already present goes to absorb(kept, incoming): true means its elements
+  // were folded into kept and it is freed, false leaves it in other. Small
+  // inputs are relinked one by one, large ones merged along the in-order
+  // links and both trees rebuilt balanced in O(n + m).
+  template <typename Absorb>
+  void merge_from(AVL &other, Absorb absorb) {
+    if (this == &other || !other.root_) return;
+    if (root_ && other.size_ < size_ / bit_width(size_)) {
+      for (node_type *node = other.begin(); node;) {
+        node_type *following = node->next;
+        node_type *kept = find_key(node->key_.first);
+        if (!kept) {
+          insert_node(other.extract_node(node));
+        } else if (absorb(kept, node)) {
+          other.erase_node(node);
+          reweigh(kept);
+        }
+        node = following;
+      }
+      return;
+    }
+    s21::Vector<node_type *> merged;
+    s21::Vector<node_type *> rest;
+    merged.reserve(size_ + other.size_);
+    node_type *mine = begin();
+    node_type *theirs = other.begin();
+    while (mine || theirs) {
+      if (!mine ||
+          (theirs && key_less(theirs->key_.first, mine->key_.first))) {
+        merged.push_back(theirs);
+        theirs = theirs->next;
+        continue;
+      }
+      if (theirs && !key_less(mine->key_.first, theirs->key_.first)) {
+        node_type *incoming = theirs;
+        theirs = theirs->next;
+        if (absorb(mine, incoming)) {
+          delete incoming;
+        } else {
+          rest.push_back(incoming);
+        }
+      }
+      merged.push_back(mine);
+      mine = mine->next;
+    }
+    build(merged);
+    other.build(rest);
+  }
+
+  // ---------------- Bulk construction ---------------------
+
+  // Links nodes into the tree in O(n + m) when they are already ordered and
+  // O((n + m) + m log m) otherwise. Nodes with equal keys, within the batch
+  // or against the tree, are folded by combine(kept, dropped) and the
+  // dropped batch node is freed; batch order decides which one is kept.
+  template <typename Combine>
+  void bulk_insert(s21::Vector<node_type *> &nodes, Combine combine) {
+    if (nodes.empty()) return;
+    auto less = [this](const node_type *a, const node_type *b) {
+      return key_less(a->key_.first, b->key_.first);
+    };
+    bool sorted = true;
+    for (size_type i = 1; i < nodes.size() && sorted; ++i) {
+      sorted = !less(nodes[i], nodes[i - 1]);
+    }
+    if (!sorted) std::stable_sort(nodes.begin(), nodes.end(), less);
+    size_type kept = 0;
+    for (size_type i = 0; i < nodes.size(); ++i) {
+      if (kept && !less(nodes[kept - 1], nodes[i])) {
+        combine(nodes[kept - 1], nodes[i]);
+        delete nodes[i];
+      } else {
+        nodes[kept++] = nodes[i];
+      }
+    }
+    while (nodes.size() > kept) nodes.pop_back();
+    if (root_ && kept < size_ / bit_width(size_)) {
+      // Too small a batch to pay for an O(n + m) rebuild.
+      for (node_type *fresh : nodes) {
+        std::pair<node_type *, bool> result = insert_node(fresh);
+        if (!result.second) {
+          combine(result.first, fresh);
+          delete fresh;
+          reweigh(result.first);
+        }
+      }
+      return;
+    }
+    if (root_) merge_into(nodes, combine);
+    build(nodes);
   }
 
   void clear() {
@@ -93,52 +384,240 @@ class AVL {
     }
   }
 
+  // ---------------- Split and join ---------------------
+
+  // Moves every key not ordered before key into greater, which must be
+  // empty, in O(log n).
+  template <typename K>
+  void split(const K &key, AVL &greater) {
+    node_type *less = nullptr;
+    node_type *rest = nullptr;
+    split_subtree(root_, key, less, rest);
+    root_ = less;
+    greater.root_ = rest;
+    if (root_) find_max(root_)->next = nullptr;
+    if (rest) find_min(rest)->prev = nullptr;
+    size_ = get_weight(root_);
+    greater.size_ = get_weight(rest);
+  }
+
+  // Appends greater, whose keys must all order after this tree's, in
+  // O(log n) and leaves it empty.
+  void join(AVL &greater) {
+    if (!greater.root_) return;
+    if (!root_) {
+      std::swap(root_, greater.root_);
+      std::swap(size_, greater.size_);
+      return;
+    }
+    node_type *middle = greater.extract_node(greater.begin());
+    node_type *last = find_max(root_);
+    last->next = middle;
+    middle->prev = last;
+    if (greater.root_) {
+      middle->next = greater.begin();
+      middle->next->prev = middle;
+    }
+    root_ = join_subtrees(root_, middle, greater.root_);
+    size_ = get_weight(root_);
+    greater.root_ = nullptr;
+    greater.size_ = 0;
+  }
+
+  // Moves the nodes [first, last) into out, which must be empty, with two
+  // splits and a join: O(log n) whatever the length of the range.
+  void cut(node_type *first, node_type *last, AVL &out) {
+    if (!first || first == last) return;
+    split(first->key_.first, out);
+    if (last) {
+      AVL rest(key_comp());
+      out.split(last->key_.first, rest);
+      join(rest);
+    }
+  }
+
+  // Moves the nodes with keys in [lo, hi) into out, which must be empty.
+  template <typename K>
+  void cut_keys(const K &lo, const K &hi, AVL &out) {
+    if (spans(lo, hi)) cut(lower_bound_key(lo), lower_bound_key(hi), out);
+  }
+
+  // Frees the nodes [first, last) in O(log n + k).
+  void erase_range(node_type *first, node_type *last) {
+    AVL doomed(key_comp());
+    cut(first, last, doomed);
+  }
+
+  // Frees every node for which pred(node) holds in one O(n) pass, then
+  // rebuilds the survivors balanced. Returns the weight removed.
+  template <typename Pred>
+  size_type erase_nodes_if(Pred pred) {
+    s21::Vector<node_type *> kept;
+    size_type before = size_;
+    bool removed = false;
+    for (node_type *node = begin(); node;) {
+      node_type *following = node->next;
+      if (pred(node)) {
+        delete node;
+        removed = true;
+      } else {
+        kept.push_back(node);
+      }
+      node = following;
+    }
+    if (!removed) return 0;
+    build(kept);
+    return before - size_;
+  }
+
+  // ---------------- Partitioning ---------------------
+
+  // Cuts the tree into about `chunks` in-order slices of similar weight.
+  // Whole subtrees light enough for one slice are taken as they are and
+  // heavier ones are opened at their root, so this costs O(chunks log n)
+  // and never walks the elements.
+  template <typename Slice>
+  s21::Vector<Slice> partition(size_type chunks) const {
+    s21::Vector<Run> runs;
+    size_type total = get_weight(root_);
+    if (chunks == 0) chunks = 1;
+    collect_runs(root_, std::max<size_type>((total + chunks - 1) / chunks, 1),
+                 runs);
+    s21::Vector<Slice> slices;
+    slices.reserve(runs.size());
+    for (const Run &run : runs) {
+      using SliceIterator = decltype(std::declval<Slice>().begin());
+      slices.push_back(Slice(SliceIterator(run.first),
+                             SliceIterator(run.last->next), run.weight));
+    }
+    return slices;
+  }
+
+  // ---------------- Set algebra ---------------------
+
+  // Replaces this tree by its combination with other, which is consumed.
+  // Following Blelloch et al., "Just Join for Parallel Ordered Sets": split
+  // other by this root's key, combine the halves recursively and join the
+  // results, which costs O(m log(n/m + 1)) for sizes m <= n. Nodes whose key
+  // is in both trees go to resolve(mine, theirs), which may update mine and
+  // tells whether it stays; theirs is freed. Unmatched nodes stay if
+  // keep_mine/keep_theirs says so. fork(left, right) runs the two recursive
+  // halves and may do so in parallel.
+  template <typename Resolve, typename Fork>
+  void combine_with(AVL &other, bool keep_mine, bool keep_theirs,
+                    Resolve resolve, Fork fork) {
+    if (this == &other) {
+      s21::Vector<node_type *> kept;
+      for (node_type *node = begin(); node;) {
+        node_type *following = node->next;
+        if (resolve(node, node)) {
+          kept.push_back(node);
+        } else {
+          delete node;
+        }
+        node = following;
+      }
+      build(kept);
+      return;
+    }
+    Piece result =
+        combine(whole(), other.whole(), keep_mine, keep_theirs, resolve, fork);
+    if (result.root) {
+      result.first->prev = nullptr;
+      result.last->next = nullptr;
+    }
+    root_ = result.root;
+    size_ = get_weight(root_);
+    other.root_ = nullptr;
+    other.size_ = 0;
+  }
+
   // ---------------- Utilitaty functions ---------------------
 
-  node_type *inserts(Key key, node_type *node) {
-    if (node == nullptr) {
-      node = new node_type{key, 0};
-      size_++;
-      node->left = node->right = nullptr;
+  node_type *insert(const Key &key) {
+    return try_emplace(key.first, key).first;
+  }
+  node_type *insert(Key &&key) {
+    return try_emplace(key.first, std::move(key)).first;
+  }
 
-    } else if (key.first < node->key_.first) {
-      node->left = inserts(key, node->left);
-    } else if (key.first > node->key_.first) {
-      node->right = inserts(key, node->right);
+  // Looks key up and, if it is absent, builds the node from args in the same
+  // descent. args are only consumed when a node is created.
+  template <typename K, typename... Args>
+  std::pair<node_type *, bool> try_emplace(const K &key, Args &&...args) {
+    node_type *parent = nullptr;
+    node_type **link = &root_;
+    while (*link) {
+      parent = *link;
+      if (key_less(key, parent->key_.first)) {
+        link = &parent->left;
+      } else if (key_less(parent->key_.first, key)) {
+        link = &parent->right;
+      } else {
+        return {parent, false};
+      }
     }
-    return balance(node);
+    node_type *fresh =
+        new node_type(std::in_place, std::forward<Args>(args)...);
+    attach(parent, link, fresh);
+    return {fresh, true};
   }
 
-  node_type *insert(Key key) {
-    root_ = inserts(key, root_);
-    make_parents(root_, nullptr);
-    return search(key);
+  // Links an already built node. On a duplicate key the existing node is
+  // returned and fresh is left to the caller.
+  std::pair<node_type *, bool> insert_node(node_type *fresh) {
+    node_type *parent = nullptr;
+    node_type **link = &root_;
+    while (*link) {
+      parent = *link;
+      if (key_less(fresh->key_.first, parent->key_.first)) {
+        link = &parent->left;
+      } else if (key_less(parent->key_.first, fresh->key_.first)) {
+        link = &parent->right;
+      } else {
+        return {parent, false};
+      }
+    }
+    attach(parent, link, fresh);
+    return {fresh, true};
+  }
+
+  // Same, but if fresh belongs right before hint (nullptr meaning end) it is
+  // linked there without a search from the root.
+  std::pair<node_type *, bool> insert_node(node_type *hint, node_type *fresh) {
+    const auto &key = fresh->key_.first;
+    if (hint == nullptr || key_less(key, hint->key_.first)) {
+      node_type *before = hint ? prev(hint) : root_ ? find_max(root_) : nullptr;
+      if (!before || key_less(before->key_.first, key)) {
+        if (hint && !hint->left) {
+          attach(hint, &hint->left, fresh);
+        } else if (before) {
+          attach(before, &before->right, fresh);
+        } else {
+          attach(nullptr, &root_, fresh);
+        }
+        return {fresh, true};
+      }
+    }
+    return insert_node(fresh);
   }
 
-  AVL<Key, T> &copy_tree(node_type *node, const node_type *other_node) {
+  AVL &copy_tree(node_type *node, const node_type *other_node) {
     if (other_node) {
       if (other_node->left) {
-        node->left =
-            new node_type(other_node->left->key_, other_node->left->height);
+        node->left = clone(other_node->left);
+        node->left->parent = node;
         copy_tree(node->left, other_node->left);
       }
       if (other_node->right) {
-        node->right =
-            new node_type(other_node->right->key_, other_node->right->height);
+        node->right = clone(other_node->right);
+        node->right->parent = node;
         copy_tree(node->right, other_node->right);
       }
     }
     return *this;
   }
 
-  void make_parents(node_type *node, node_type *parent) {
-    if (node) {
-      node->parent = parent;
-      make_parents(node->left, node);
-      make_parents(node->right, node);
-    }
-  }
-
   void free_tree(node_type *node) {
     if (node) {
       if (node->left) {
@@ -151,25 +630,142 @@ class AVL {
     }
   }
 
-  node_type *search_elem(Key key, node_type *node) {
-    if (!node) {
-      return nullptr;
+  template <typename K>
+  node_type *find_key(const K &key) const {
+    node_type *node = root_;
+    while (node) {
+      if (key_less(key, node->key_.first)) {
+        node = node->left;
+      } else if (key_less(node->key_.first, key)) {
+        node = node->right;
+      } else {
+        return node;
+      }
     }
+    return nullptr;
+  }
 
-    if (key.first < node->key_.first) {
-      return search_elem(key, node->left);
-    } else if (key.first > node->key_.first) {
-      return search_elem(key, node->right);
-    } else {
-      return node;
+  // First node whose key is not ordered before key.
+  template <typename K>
+  node_type *lower_bound_key(const K &key) const {
+    node_type *node = root_;
+    node_type *result = nullptr;
+    while (node) {
+      if (key_less(node->key_.first, key)) {
+        node = node->right;
+      } else {
+        result = node;
+        node = node->left;
+      }
+    }
+    return result;
+  }
+
+  // First node whose key is ordered after key.
+  template <typename K>
+  node_type *upper_bound_key(const K &key) const {
+    node_type *node = root_;
+    node_type *result = nullptr;
+    while (node) {
+      if (key_less(key, node->key_.first)) {
+        result = node;
+        node = node->left;
+      } else {
+        node = node->right;
+      }
     }
+    return result;
   }
 
-  node_type *search(Key key) { return search_elem(key, root_); }
+  node_type *search(const Key &key) const { return find_key(key.first); }
+
+  const Compare &key_comp() const noexcept { return *this; }
+
+  template <typename A, typename B>
+  bool key_less(const A &a, const B &b) const {
+    return key_comp()(a, b);
+  }
 
   void update_height(node_type *node) {
     node->height =
         std::max(get_height(node->left), get_height(node->right)) + 1;
+    node->weight = get_weight(node->left) + Weight()(node->key_) +
+                   get_weight(node->right);
+  }
+
+  static size_type get_weight(const node_type *node) {
+    return node ? node->weight : 0;
+  }
+
+  // Refreshes subtree weights above a node whose own weight changed.
+  void reweigh(node_type *node) {
+    for (; node; node = node->parent) update_height(node);
+    size_ = get_weight(root_);
+  }
+
+  // ---------------- Order statistics ---------------------
+
+  size_type total_weight() const { return get_weight(root_); }
+
+  // Weight of all elements ordered before key.
+  template <typename K>
+  size_type rank_key(const K &key) const {
+    size_type rank = 0;
+    node_type *node = root_;
+    while (node) {
+      if (key_less(node->key_.first, key)) {
+        rank += get_weight(node->left) + Weight()(node->key_);
+        node = node->right;
+      } else {
+        node = node->left;
+      }
+    }
+    return rank;
+  }
+
+  // Whether some key lies in [lo, hi). Decided from tree positions, never
+  // by comparing lo with hi: a transparent Compare may only order probes
+  // against keys (two string literals would compare as pointers).
+  template <typename K>
+  bool spans(const K &lo, const K &hi) const {
+    return rank_key(lo) < rank_key(hi);
+  }
+
+  // Weight of the elements with keys in [lo, hi).
+  template <typename K>
+  size_type weight_between(const K &lo, const K &hi) const {
+    size_type l = rank_key(lo);
+    size_type h = rank_key(hi);
+    return h > l ? h - l : 0;
+  }
+
+  // The nodes with keys in [lo, hi) as a range of Iterator.
+  template <typename Iterator, typename K>
+  TreeRange<Iterator> key_range(const K &lo, const K &hi) const {
+    if (!spans(lo, hi)) return {Iterator(nullptr), Iterator(nullptr)};
+    return {Iterator(lower_bound_key(lo)), Iterator(lower_bound_key(hi))};
+  }
+
+  // Node holding the k-th unit of weight (0-based) or nullptr past the end.
+  // offset receives the position of that unit inside the node.
+  node_type *select_node(size_type k, size_type &offset) const {
+    node_type *node = root_;
+    while (node) {
+      size_type left = get_weight(node->left);
+      if (k < left) {
+        node = node->left;
+        continue;
+      }
+      k -= left;
+      size_type own = Weight()(node->key_);
+      if (k < own) {
+        offset = k;
+        return node;
+      }
+      k -= own;
+      node = node->right;
+    }
+    return nullptr;
   }
 
   int get_height(const node_type *node) const {
@@ -183,7 +779,10 @@ class AVL {
   node_type *right_rotate(node_type *node) {
     node_type *buffer = node->left;
     node->left = buffer->right;
+    if (node->left) node->left->parent = node;
     buffer->right = node;
+    buffer->parent = node->parent;
+    node->parent = buffer;
     update_height(node);
     update_height(buffer);
     return buffer;
@@ -192,7 +791,10 @@ class AVL {
   node_type *left_rotate(node_type *node) {
     node_type *buffer = node->right;
     node->right = buffer->left;
+    if (node->right) node->right->parent = node;
     buffer->left = node;
+    buffer->parent = node->parent;
+    node->parent = buffer;
     update_height(node);
     update_height(buffer);
     return buffer;
@@ -217,38 +819,18 @@ class AVL {
   }
 
   static node_type *find_min(node_type *node) {
-    return node->left ? find_min(node->left) : node;
+    while (node->left) node = node->left;
+    return node;
   }
   static node_type *find_max(node_type *node) {
-    return node->right ? find_max(node->right) : node;
-  }
-
-  node_type *erase_min(node_type *node) {
-    if (node->left == nullptr) return node->right;
-    node->left = erase_min(node->left);
-    return balance(node);
+    while (node->right) node = node->right;
+    return node;
   }
 
-  node_type *erases(node_type *node, Key key) {
-    if (!node) return 0;
-    if (key.first < node->key_.first)
-      node->left = erases(node->left, key);
-    else if (key.first > node->key_.first)
-      node->right = erases(node->right, key);
-    else {
-      node_type *left_child = node->left;
-      node_type *right_child = node->right;
-      delete node;
-      if (!right_child) return left_child;
-      node_type *min = find_min(right_child);
-      min->right = erase_min(right_child);
-      min->left = left_child;
-      return balance(min);
-    }
-    return balance(node);
-  }
+  static node_type *next(node_type *node) { return node->next; }
+  static node_type *prev(node_type *node) { return node->prev; }
 
-  node_type *begin() { return find_min(root_); }
+  node_type *begin() { return root_ ? find_min(root_) : nullptr; }
 
   void set_size(bool sign) {
     if (sign) {
@@ -285,36 +867,12 @@ class AVL {
     }
 
     iterator &operator++() {
-      if (iterated_node_) {
-        if (iterated_node_->right) {
-          node_type *min_iter = find_min(iterated_node_->right);
-          iterated_node_ = min_iter;
-        } else {
-          while (iterated_node_->parent != nullptr &&
-                 iterated_node_->parent->key_.first <
-                     iterated_node_->key_.first) {
-            iterated_node_ = iterated_node_->parent;
-          }
-          iterated_node_ = iterated_node_->parent;
-        }
-      }
+      if (iterated_node_) iterated_node_ = next(iterated_node_);
       return *this;
     }
 
     iterator &operator--() {
-      if (iterated_node_) {
-        if (iterated_node_->left) {
-          node_type *max_iter = find_max(iterated_node_->left);
-          iterated_node_ = max_iter;
-        } else {
-          while (iterated_node_->parent != nullptr &&
-                 iterated_node_->parent->key_.first >
-                     iterated_node_->key_.first) {
-            iterated_node_ = iterated_node_->parent;
-          }
-          iterated_node_ = iterated_node_->parent;
-        }
-      }
+      if (iterated_node_) iterated_node_ = prev(iterated_node_);
       return *this;
     }
 
@@ -324,11 +882,11 @@ class AVL {
       return empty_key_;
     };
 
-    bool operator!=(const iterator &it) {
+    bool operator!=(const iterator &it) const {
       return iterated_node_ != it.iterated_node_;
     };
 
-    bool operator==(const iterator &it) {
+    bool operator==(const iterator &it) const {
       return iterated_node_ == it.iterated_node_;
     };
 
@@ -347,6 +905,352 @@ class AVL {
   };
 
  private:
+  static node_type *clone(const node_type *other) {
+    node_type *copy = new node_type(other->key_, other->height);
+    copy->weight = other->weight;
+    return copy;
+  }
+
+  void attach(node_type *parent, node_type **link, node_type *fresh) {
+    *link = fresh;
+    fresh->parent = parent;
+    if (!parent) {
+      fresh->prev = fresh->next = nullptr;
+    } else if (link == &parent->left) {
+      fresh->next = parent;
+      fresh->prev = parent->prev;
+    } else {
+      fresh->prev = parent;
+      fresh->next = parent->next;
+    }
+    if (fresh->prev) fresh->prev->next = fresh;
+    if (fresh->next) fresh->next->prev = fresh;
+    update_height(fresh);
+    size_ += Weight()(fresh->key_);
+    rebalance(parent);
+  }
+
+  // Moves the tree's nodes into the ordered batch, folding equal keys.
+  template <typename Combine>
+  void merge_into(s21::Vector<node_type *> &batch, Combine combine) {
+    s21::Vector<node_type *> merged;
+    merged.reserve(size_ + batch.size());
+    node_type *mine = begin();
+    size_type j = 0;
+    while (mine || j < batch.size()) {
+      if (!mine || (j < batch.size() &&
+                    key_less(batch[j]->key_.first, mine->key_.first))) {
+        merged.push_back(batch[j++]);
+      } else {
+        if (j < batch.size() &&
+            !key_less(mine->key_.first, batch[j]->key_.first)) {
+          combine(mine, batch[j]);
+          delete batch[j++];
+        }
+        merged.push_back(mine);
+        mine = mine->next;
+      }
+    }
+    root_ = nullptr;
+    batch.swap(merged);
+  }
+
+  static size_type bit_width(size_type value) {
+    size_type width = 0;
+    for (; value; value >>= 1) ++width;
+    return width;
+  }
+
+  // Replaces the tree with a perfectly balanced one over ordered nodes.
+  void build(s21::Vector<node_type *> &nodes) {
+    root_ = build_subtree(nodes.data(), nodes.size(), nullptr);
+    for (size_type i = 0; i < nodes.size(); ++i) {
+      nodes[i]->prev = i ? nodes[i - 1] : nullptr;
+      nodes[i]->next = i + 1 < nodes.size() ? nodes[i + 1] : nullptr;
+    }
+    size_ = get_weight(root_);
+  }
+
+  node_type *build_subtree(node_type **nodes, size_type count,
+                           node_type *parent) {
+    if (!count) return nullptr;
+    size_type middle = count / 2;
+    node_type *root = nodes[middle];
+    root->parent = parent;
+    root->left = build_subtree(nodes, middle, root);
+    root->right = build_subtree(nodes + middle + 1, count - middle - 1, root);
+    update_height(root);
+    return root;
+  }
+
+  // Rebuilds the in-order links after a structural copy.
+  void thread() {
+    node_type *last = nullptr;
+    thread_subtree(root_, last);
+  }
+
+  static void thread_subtree(node_type *node, node_type *&last) {
+    if (!node) return;
+    thread_subtree(node->left, last);
+    node->prev = last;
+    node->next = nullptr;
+    if (last) last->next = node;
+    last = node;
+    thread_subtree(node->right, last);
+  }
+
+  void replace_child(node_type *old_child, node_type *new_child) {
+    node_type *parent = old_child->parent;
+    if (!parent) {
+      root_ = new_child;
+    } else if (parent->left == old_child) {
+      parent->left = new_child;
+    } else {
+      parent->right = new_child;
+    }
+    if (new_child) new_child->parent = parent;
+  }
+
+  // Restores heights and balance on the path from node to the root.
+  void rebalance(node_type *node) {
+    if (node) root_ = climb(node);
+  }
+
+  // Same for a detached subtree; returns its new root.
+  node_type *climb(node_type *node) {
+    node_type *top = nullptr;
+    while (node) {
+      node_type *parent = node->parent;
+      top = balance(node);
+      if (parent && parent->left == node) {
+        parent->left = top;
+      } else if (parent) {
+        parent->right = top;
+      }
+      node = parent;
+    }
+    return top;
+  }
+
+  void adopt(node_type *node, node_type *left, node_type *right) {
+    node->left = left;
+    node->right = right;
+    if (left) left->parent = node;
+    if (right) right->parent = node;
+    update_height(node);
+  }
+
+  // Joins subtrees whose keys all order before and after middle, in time
+  // proportional to their height difference. In-order links are the
+  // caller's business.
+  node_type *join_subtrees(node_type *left, node_type *middle,
+                           node_type *right) {
+    int left_height = get_height(left);
+    int right_height = get_height(right);
+    node_type *parent = nullptr;
+    if (left_height > right_height + 1) {
+      node_type *spine = left;
+      while (get_height(spine) > right_height + 1) {
+        parent = spine;
+        spine = spine->right;
+      }
+      adopt(middle, spine, right);
+      parent->right = middle;
+    } else if (right_height > left_height + 1) {
+      node_type *spine = right;
+      while (get_height(spine) > left_height + 1) {
+        parent = spine;
+        spine = spine->left;
+      }
+      adopt(middle, left, spine);
+      parent->left = middle;
+    } else {
+      adopt(middle, left, right);
+    }
+    middle->parent = parent;
+    return parent ? climb(parent) : middle;
+  }
+
+  struct Run {
+    node_type *first;
+    node_type *last;
+    size_type weight;
+  };
+
+  void collect_runs(node_type *node, size_type target,
+                    s21::Vector<Run> &runs) const {
+    if (!node) return;
+    if (node->weight <= target) {
+      add_run(runs, find_min(node), find_max(node), node->weight, target);
+      return;
+    }
+    collect_runs(node->left, target, runs);
+    add_run(runs, node, node, Weight()(node->key_), target);
+    collect_runs(node->right, target, runs);
+  }
+
+  // Adjacent runs are merged until a slice reaches the target weight.
+  static void add_run(s21::Vector<Run> &runs, node_type *first,
+                      node_type *last, size_type weight, size_type target) {
+    if (!runs.empty() && runs[runs.size() - 1].weight < target) {
+      runs[runs.size() - 1].last = last;
+      runs[runs.size() - 1].weight += weight;
+    } else {
+      runs.push_back(Run{first, last, weight});
+    }
+  }
+
+  // A detached subtree with its in-order first and last nodes. Links inside
+  // a piece are valid; those leaving it are patched when pieces are joined.
+  struct Piece {
+    node_type *root;
+    node_type *first;
+    node_type *last;
+  };
+
+  // Steps whose smaller input is below this size run both halves inline.
+  static constexpr size_type kForkGrain = 2048;
+
+  Piece whole() {
+    return {root_, begin(), root_ ? find_max(root_) : nullptr};
+  }
+
+  Piece join_pieces(Piece left, node_type *middle, Piece right) {
+    node_type *root = join_subtrees(left.root, middle, right.root);
+    middle->prev = left.last;
+    middle->next = right.first;
+    if (left.last) left.last->next = middle;
+    if (right.first) right.first->prev = middle;
+    return {root, left.root ? left.first : middle,
+            right.root ? right.last : middle};
+  }
+
+  // Joins without a middle key by borrowing the last node of left.
+  Piece join_pieces(Piece left, Piece right) {
+    if (!left.root) return right;
+    if (!right.root) return left;
+    node_type *middle = left.last;
+    node_type *parent = middle->parent;
+    if (middle->left) middle->left->parent = parent;
+    if (parent) {
+      parent->right = middle->left;
+      left.root = climb(parent);
+    } else {
+      left.root = middle->left;
+    }
+    if (left.root) {
+      left.last = middle->prev;
+    } else {
+      left.first = left.last = nullptr;
+    }
+    return join_pieces(left, middle, right);
+  }
+
+  // Splits a piece into keys ordered before key, the node equal to key if
+  // any, and keys ordered after it.
+  template <typename K>
+  void split_piece(Piece piece, const K &key, Piece &less, node_type *&found,
+                   Piece &greater) {
+    less = greater = Piece{nullptr, nullptr, nullptr};
+    found = nullptr;
+    split_exact(piece.root, key, less, found, greater);
+    if (less.root) less.first = piece.first;
+    if (greater.root) greater.last = piece.last;
+  }
+
+  // Fills root and the inner boundary (less.last, greater.first) of both
+  // sides; the outer boundaries are the piece's own.
+  template <typename K>
+  void split_exact(node_type *node, const K &key, Piece &less,
+                   node_type *&found, Piece &greater) {
+    if (!node) return;
+    node_type *left = node->left;
+    node_type *right = node->right;
+    if (left) left->parent = nullptr;
+    if (right) right->parent = nullptr;
+    if (key_less(node->key_.first, key)) {
+      split_exact(right, key, less, found, greater);
+      if (!less.root) less.last = node;
+      less.root = join_subtrees(left, node, less.root);
+    } else if (key_less(key, node->key_.first)) {
+      split_exact(left, key, less, found, greater);
+      if (!greater.root) greater.first = node;
+      greater.root = join_subtrees(greater.root, node, right);
+    } else {
+      found = node;
+      node->left = node->right = nullptr;
+      less.root = left;
+      less.last = left ? node->prev : nullptr;
+      greater.root = right;
+      greater.first = right ? node->next : nullptr;
+    }
+  }
+
+  template <typename Resolve, typename Fork>
+  Piece combine(Piece mine, Piece theirs, bool keep_mine, bool keep_theirs,
+                Resolve &resolve, Fork &fork) {
+    if (!mine.root || !theirs.root) {
+      Piece &kept = mine.root ? mine : theirs;
+      if (mine.root ? keep_mine : keep_theirs) return kept;
+      free_tree(kept.root);
+      return Piece{nullptr, nullptr, nullptr};
+    }
+    // The smaller side bounds the work below this step.
+    size_type work = std::min(get_weight(mine.root), get_weight(theirs.root));
+    node_type *root = mine.root;
+    Piece mine_less{root->left, mine.first, root->prev};
+    Piece mine_greater{root->right, root->next, mine.last};
+    if (!root->left) mine_less = Piece{nullptr, nullptr, nullptr};
+    if (!root->right) mine_greater = Piece{nullptr, nullptr, nullptr};
+    if (root->left) root->left->parent = nullptr;
+    if (root->right) root->right->parent = nullptr;
+    root->left = root->right = nullptr;
+    Piece theirs_less, theirs_greater;
+    node_type *found;
+    split_piece(theirs, root->key_.first, theirs_less, found, theirs_greater);
+    Piece less, greater;
+    auto combine_less = [&] {
+      less = combine(mine_less, theirs_less, keep_mine, keep_theirs, resolve,
+                     fork);
+    };
+    auto combine_greater = [&] {
+      greater = combine(mine_greater, theirs_greater, keep_mine, keep_theirs,
+                        resolve, fork);
+    };
+    if (work > kForkGrain) {
+      fork(combine_less, combine_greater);
+    } else {
+      combine_less();
+      combine_greater();
+    }
+    bool keep = found ? resolve(root, found) : keep_mine;
+    delete found;
+    if (keep) return join_pieces(less, root, greater);
+    delete root;
+    return join_pieces(less, greater);
+  }
+
+  // Splits a detached subtree into keys ordered before key and the rest.
+  template <typename K>
+  void split_subtree(node_type *node, const K &key, node_type *&less,
+                     node_type *&rest) {
+    if (!node) {
+      less = rest = nullptr;
+      return;
+    }
+    node_type *left = node->left;
+    node_type *right = node->right;
+    if (left) left->parent = nullptr;
+    if (right) right->parent = nullptr;
+    if (key_less(node->key_.first, key)) {
+      split_subtree(right, key, less, rest);
+      less = join_subtrees(left, node, less);
+    } else {
+      split_subtree(left, key, less, rest);
+      rest = join_subtrees(rest, node, right);
+    }
+  }
+
   node_type *root_;
   size_type size_;
 };
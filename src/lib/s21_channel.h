@@ -0,0 +1,361 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_CHANNEL_H
+#define CPP2_S21_CONTAINERS_SRC_CHANNEL_H
+
+#if !defined(__cpp_impl_coroutine)
+#error "s21_channel.h requires C++20 coroutines (-std=c++20)"
+#endif
+
+#include <coroutine>
+#include <exception>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+#include "s21_mpmc_queue.h"
+#include "s21_queue.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// Something that resumes coroutines. Channels hand woken waiters to it
+// instead of resuming them inline on the waker's stack.
+class Executor {
+ public:
+  virtual ~Executor() {}
+  virtual void schedule(std::coroutine_handle<> handle) = 0;
+};
+
+// Single-threaded executor: run() resumes ready coroutines on the calling
+// thread until none are left.
+class RunLoop : public Executor {
+ public:
+  void schedule(std::coroutine_handle<> handle) override {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ready_.push_back(handle);
+  }
+
+  // Returns the number of coroutines resumed.
+  std::size_t run() {
+    std::size_t resumed = 0;
+    s21::Vector<std::coroutine_handle<>> batch;
+    for (;;) {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (ready_.empty()) return resumed;
+        batch.swap(ready_);
+      }
+      for (std::coroutine_handle<> handle : batch) handle.resume();
+      resumed += batch.size();
+      batch.clear();
+    }
+  }
+
+ private:
+  std::mutex mutex_;
+  s21::Vector<std::coroutine_handle<>> ready_;
+};
+
+// Fixed pool of threads resuming coroutines from a lock-free MpmcQueue.
+// A worker never blocks on the bounded queue: when it is full, handles a
+// worker schedules go to that worker's own unbounded queue, which it
+// drains before taking shared work. Otherwise a pool whose workers all
+// wake more coroutines than fit could stall with every thread in push().
+class ThreadPoolExecutor : public Executor {
+ public:
+  explicit ThreadPoolExecutor(std::size_t threads, std::size_t capacity = 4096)
+      : ready_(capacity), threads_(threads ? threads : 1) {
+    for (std::thread &thread : threads_) {
+      thread = std::thread([this] {
+        Worker self{this, {}};
+        current() = &self;
+        std::coroutine_handle<> handle;
+        for (;;) {
+          if (!self.overflow.empty()) {
+            handle = self.overflow.front();
+            self.overflow.pop();
+          } else {
+            ready_.pop(handle);
+            if (!handle) break;
+          }
+          handle.resume();
+        }
+        current() = nullptr;
+      });
+    }
+  }
+
+  // Stops after the coroutines already scheduled have been resumed.
+  ~ThreadPoolExecutor() {
+    for (std::size_t i = 0; i < threads_.size(); ++i) {
+      ready_.push(std::coroutine_handle<>());
+    }
+    for (std::thread &thread : threads_) thread.join();
+  }
+
+  void schedule(std::coroutine_handle<> handle) override {
+    Worker *self = current();
+    if (self && self->pool == this) {
+      if (!ready_.try_push(handle)) self->overflow.push(handle);
+      return;
+    }
+    ready_.push(handle);
+  }
+
+ private:
+  struct Worker {
+    ThreadPoolExecutor *pool;
+    s21::Queue<std::coroutine_handle<>> overflow;
+  };
+
+  // The calling thread's worker state, or nullptr off the pool.
+  static Worker *&current() {
+    static thread_local Worker *worker = nullptr;
+    return worker;
+  }
+
+  s21::MpmcQueue<std::coroutine_handle<>> ready_;
+  s21::Vector<std::thread> threads_;
+};
+
+// Eagerly started, fire-and-forget coroutine. The frame frees itself when
+// the body finishes.
+struct Detached {
+  struct promise_type {
+    Detached get_return_object() noexcept { return {}; }
+    std::suspend_never initial_suspend() noexcept { return {}; }
+    std::suspend_never final_suspend() noexcept { return {}; }
+    void return_void() noexcept {}
+    void unhandled_exception() { std::terminate(); }
+  };
+};
+
+// Awaitable that moves the awaiting coroutine onto an executor.
+struct ResumeOn {
+  Executor &executor;
+  bool await_ready() const noexcept { return false; }
+  void await_suspend(std::coroutine_handle<> handle) {
+    executor.schedule(handle);
+  }
+  void await_resume() const noexcept {}
+};
+
+// Bounded MPMC channel between coroutines, buffered in an s21::Queue. A
+// full push or empty pop suspends the coroutine instead of blocking the
+// thread; the awaiter itself is the wait-list node, so waiting allocates
+// nothing. Woken coroutines are resumed through the executor.
+template <typename T, typename Container = s21::List<T>>
+class Channel {
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+
+  class PopAwaiter;
+  class PushAwaiter;
+
+  explicit Channel(Executor &executor,
+                   size_type capacity = std::numeric_limits<size_type>::max())
+      : executor_(executor), capacity_(capacity), closed_(false) {}
+
+  Channel(const Channel &) = delete;
+  Channel &operator=(const Channel &) = delete;
+
+  // co_await yields std::optional<T>, empty once closed and drained.
+  PopAwaiter pop() { return PopAwaiter(*this); }
+
+  // co_await yields false if the channel was closed before delivery.
+  PushAwaiter push(value_type value) {
+    return PushAwaiter(*this, std::move(value));
+  }
+
+  bool try_push(value_type value) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (closed_) return false;
+    if (PopAwaiter *waiter = pop_waiters_.take()) {
+      waiter->result_.emplace(std::move(value));
+      lock.unlock();
+      executor_.schedule(waiter->handle_);
+      return true;
+    }
+    if (buffer_.size() >= capacity_) return false;
+    buffer_.push(std::move(value));
+    return true;
+  }
+
+  std::optional<value_type> try_pop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    return take_locked(lock);
+  }
+
+  // Wakes every suspended coroutine. Buffered values can still be popped.
+  void close() {
+    PopAwaiter *pops;
+    PushAwaiter *pushes;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      closed_ = true;
+      pops = pop_waiters_.take_all();
+      pushes = push_waiters_.take_all();
+    }
+    while (pops) {
+      PopAwaiter *next = pops->next_;
+      executor_.schedule(pops->handle_);
+      pops = next;
+    }
+    while (pushes) {
+      PushAwaiter *next = pushes->next_;
+      executor_.schedule(pushes->handle_);
+      pushes = next;
+    }
+  }
+
+  bool closed() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return closed_;
+  }
+
+  size_type size() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return buffer_.size();
+  }
+
+  size_type capacity() const noexcept { return capacity_; }
+
+  class PopAwaiter {
+   public:
+    bool await_ready() const noexcept { return false; }
+
+    bool await_suspend(std::coroutine_handle<> handle) {
+      std::unique_lock<std::mutex> lock(channel_.mutex_);
+      if (!channel_.buffer_.empty() || !channel_.push_waiters_.empty() ||
+          channel_.closed_) {
+        result_ = channel_.take_locked(lock);
+        return false;
+      }
+      handle_ = handle;
+      channel_.pop_waiters_.append(this);
+      return true;
+    }
+
+    std::optional<value_type> await_resume() { return std::move(result_); }
+
+   private:
+    friend class Channel;
+
+    explicit PopAwaiter(Channel &channel) : channel_(channel) {}
+
+    Channel &channel_;
+    std::optional<value_type> result_;
+    std::coroutine_handle<> handle_;
+    PopAwaiter *next_ = nullptr;
+  };
+
+  class PushAwaiter {
+   public:
+    bool await_ready() const noexcept { return false; }
+
+    bool await_suspend(std::coroutine_handle<> handle) {
+      std::unique_lock<std::mutex> lock(channel_.mutex_);
+      if (channel_.closed_) return false;
+      if (PopAwaiter *waiter = channel_.pop_waiters_.take()) {
+        waiter->result_.emplace(std::move(value_));
+        delivered_ = true;
+        lock.unlock();
+        channel_.executor_.schedule(waiter->handle_);
+        return false;
+      }
+      if (channel_.buffer_.size() < channel_.capacity_) {
+        channel_.buffer_.push(std::move(value_));
+        delivered_ = true;
+        return false;
+      }
+      handle_ = handle;
+      channel_.push_waiters_.append(this);
+      return true;
+    }
+
+    bool await_resume() const noexcept { return delivered_; }
+
+   private:
+    friend class Channel;
+
+    PushAwaiter(Channel &channel, value_type value)
+        : channel_(channel), value_(std::move(value)) {}
+
+    Channel &channel_;
+    value_type value_;
+    bool delivered_ = false;
+    std::coroutine_handle<> handle_;
+    PushAwaiter *next_ = nullptr;
+  };
+
+ private:
+  // Intrusive FIFO of suspended awaiters.
+  template <typename Node>
+  class WaitList {
+   public:
+    bool empty() const noexcept { return head_ == nullptr; }
+
+    void append(Node *node) {
+      node->next_ = nullptr;
+      if (tail_) {
+        tail_->next_ = node;
+      } else {
+        head_ = node;
+      }
+      tail_ = node;
+    }
+
+    Node *take() {
+      Node *node = head_;
+      if (node) {
+        head_ = node->next_;
+        if (!head_) tail_ = nullptr;
+      }
+      return node;
+    }
+
+    Node *take_all() {
+      Node *node = head_;
+      head_ = tail_ = nullptr;
+      return node;
+    }
+
+   private:
+    Node *head_ = nullptr;
+    Node *tail_ = nullptr;
+  };
+
+  // Takes the oldest value and lets one suspended pusher refill the buffer.
+  std::optional<value_type> take_locked(std::unique_lock<std::mutex> &lock) {
+    std::optional<value_type> result;
+    PushAwaiter *pusher = nullptr;
+    if (!buffer_.empty()) {
+      result.emplace(std::move(buffer_.front()));
+      buffer_.pop();
+      if ((pusher = push_waiters_.take())) {
+        buffer_.push(std::move(pusher->value_));
+      }
+    } else if ((pusher = push_waiters_.take())) {
+      result.emplace(std::move(pusher->value_));
+    }
+    if (pusher) {
+      pusher->delivered_ = true;
+      lock.unlock();
+      executor_.schedule(pusher->handle_);
+    }
+    return result;
+  }
+
+  Executor &executor_;
+  const size_type capacity_;
+  bool closed_;
+  std::mutex mutex_;
+  s21::Queue<value_type, Container> buffer_;
+  WaitList<PopAwaiter> pop_waiters_;
+  WaitList<PushAwaiter> push_waiters_;
+};
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_CHANNEL_H
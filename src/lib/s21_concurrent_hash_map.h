@@ -0,0 +1,379 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_CONCURRENT_HASH_MAP_H
+#define CPP2_S21_CONTAINERS_SRC_CONCURRENT_HASH_MAP_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <utility>
+
+#include "s21_epoch.h"
+#include "s21_hash_mix.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// Hash map whose lookups take no lock: buckets are chains of immutable
+// nodes read under an epoch pin, and writers, serialized per lock stripe,
+// publish whole new nodes and retire the ones they replace. Growing is
+// incremental: once a bigger table is attached, every write moves a batch
+// of buckets and leaves a forwarding marker behind, so readers never wait
+// and simply follow the marker into the new table.
+template <typename Key, typename T, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+class ConcurrentHashMap : private Hash, private KeyEqual {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using size_type = std::size_t;
+
+  static constexpr size_type kStripes = 64;
+  static constexpr size_type kMigrateBatch = 16;
+
+  explicit ConcurrentHashMap(size_type capacity = 0, const Hash &hash = Hash(),
+                             const KeyEqual &equal = KeyEqual())
+      : Hash(hash),
+        KeyEqual(equal),
+        stripes_(kStripes),
+        table_(new Table(buckets_for(capacity))),
+        size_(0) {}
+
+  ConcurrentHashMap(const ConcurrentHashMap &) = delete;
+  ConcurrentHashMap &operator=(const ConcurrentHashMap &) = delete;
+
+  // No other thread may use the map any more. Nodes and tables retired
+  // earlier are freed by the epoch domain.
+  ~ConcurrentHashMap() {
+    for (Table *table = table_.load(std::memory_order_acquire); table;) {
+      for (size_type i = 0; i < table->count; ++i) {
+        Node *node = table->buckets[i].load(std::memory_order_relaxed);
+        if (node == moved()) continue;
+        while (node) {
+          Node *next = node->next.load(std::memory_order_relaxed);
+          delete node;
+          node = next;
+        }
+      }
+      Table *next = table->next.load(std::memory_order_relaxed);
+      delete table;
+      table = next;
+    }
+  }
+
+  // Exact once writers have stopped.
+  size_type size() const { return size_.load(std::memory_order_relaxed); }
+  bool empty() const { return size() == 0; }
+
+  size_type bucket_count() const {
+    epoch::Guard guard = epoch::pin();
+    return table_.load(std::memory_order_acquire)->count;
+  }
+
+  // ---------------- Lookup (lock-free) ---------------------
+
+  bool contains(const key_type &key) const {
+    return visit(key, [](const mapped_type &) {});
+  }
+
+  bool find(const key_type &key, mapped_type &out) const {
+    return visit(key, [&out](const mapped_type &value) { out = value; });
+  }
+
+  // Calls f(const mapped_type &) on the value for key without locking; the
+  // value stays valid for the duration of the call even if it is replaced.
+  template <typename F>
+  bool visit(const key_type &key, F f) const {
+    epoch::Guard guard = epoch::pin();
+    std::uint64_t hash = hash_of(key);
+    for (Node *node = head_of(table_.load(std::memory_order_acquire), hash);
+         node; node = node->next.load(std::memory_order_acquire)) {
+      if (node->hash == hash && key_eq()(node->key, key)) {
+        f(node->value);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // Calls f(const key_type &, const mapped_type &) for every element. Not
+  // a snapshot: writes made meanwhile may or may not be seen.
+  template <typename F>
+  void for_each(F f) const {
+    epoch::Guard guard = epoch::pin();
+    Table *table = table_.load(std::memory_order_acquire);
+    for (size_type i = 0; i < table->count; ++i) visit_bucket(table, i, f);
+  }
+
+  // ---------------- Modifiers ---------------------
+
+  bool insert(const key_type &key, const mapped_type &obj) {
+    return write(key, [&](Link &link, Node *found, std::uint64_t hash) {
+      if (found) return 0;
+      link.store(new Node(hash, key, obj, link.load(std::memory_order_relaxed)),
+                 std::memory_order_release);
+      return 1;
+    }) > 0;
+  }
+
+  // Returns true if key was absent.
+  bool insert_or_assign(const key_type &key, const mapped_type &obj) {
+    return write(key, [&](Link &link, Node *found, std::uint64_t hash) {
+      Node *next = (found ? found->next : link).load(std::memory_order_relaxed);
+      link.store(new Node(hash, key, obj, next), std::memory_order_release);
+      if (found) epoch::retire(found);
+      return found ? 0 : 1;
+    }) > 0;
+  }
+
+  bool erase(const key_type &key) {
+    return write(key, [](Link &link, Node *found, std::uint64_t) {
+      if (!found) return 0;
+      link.store(found->next.load(std::memory_order_relaxed),
+                 std::memory_order_release);
+      epoch::retire(found);
+      return -1;
+    }) < 0;
+  }
+
+  // Returns the value for key, first storing make(key) if there is none.
+  // A present key is found without locking; make runs at most once per
+  // insertion, under the stripe lock, so it must not use this map.
+  template <typename Make>
+  mapped_type compute_if_absent(const key_type &key, Make make) {
+    mapped_type result;
+    if (find(key, result)) return result;
+    write(key, [&](Link &link, Node *found, std::uint64_t hash) {
+      if (found) {
+        result = found->value;
+        return 0;
+      }
+      Node *fresh = new Node(hash, key, make(key),
+                             link.load(std::memory_order_relaxed));
+      result = fresh->value;
+      link.store(fresh, std::memory_order_release);
+      return 1;
+    });
+    return result;
+  }
+
+  // Replaces the value for key with a copy changed by f(mapped_type &).
+  // Writers of the same key are serialized, so the update is atomic.
+  template <typename F>
+  bool update(const key_type &key, F f) {
+    bool updated = false;
+    write(key, [&](Link &link, Node *found, std::uint64_t hash) {
+      if (!found) return 0;
+      mapped_type value = found->value;
+      f(value);
+      link.store(new Node(hash, key, std::move(value),
+                          found->next.load(std::memory_order_relaxed)),
+                 std::memory_order_release);
+      epoch::retire(found);
+      updated = true;
+      return 0;
+    });
+    return updated;
+  }
+
+  // Grows the table until count elements fit, migrating it completely.
+  // Each round is pinned, as migrating retires the tables and nodes it
+  // reads; unpinning in between lets those be reclaimed.
+  void reserve(size_type count) {
+    for (;;) {
+      epoch::Guard guard = epoch::pin();
+      Table *table = table_.load(std::memory_order_acquire);
+      if (table->count >= buckets_for(count)) return;
+      start_resize(table);
+      while (help_resize()) {
+      }
+    }
+  }
+
+ private:
+  struct Node {
+    template <typename V>
+    Node(std::uint64_t h, const key_type &k, V &&v, Node *n)
+        : hash(h), key(k), value(std::forward<V>(v)), next(n) {}
+
+    const std::uint64_t hash;
+    const key_type key;
+    const mapped_type value;
+    std::atomic<Node *> next;
+  };
+
+  using Link = std::atomic<Node *>;
+
+  struct Table {
+    explicit Table(size_type buckets)
+        : count(buckets),
+          buckets(new Link[buckets]),
+          next(nullptr),
+          claimed(0),
+          migrated(0) {
+      for (size_type i = 0; i < count; ++i) {
+        this->buckets[i].store(nullptr, std::memory_order_relaxed);
+      }
+    }
+    ~Table() { delete[] buckets; }
+
+    const size_type count;
+    Link *const buckets;
+    // The table being migrated into, if a resize has started.
+    std::atomic<Table *> next;
+    std::atomic<size_type> claimed;
+    std::atomic<size_type> migrated;
+  };
+
+  struct alignas(64) Stripe {
+    std::mutex mutex;
+  };
+
+  // Stored in an old table's bucket once its chain lives in the next one.
+  static Node *moved() {
+    return reinterpret_cast<Node *>(std::uintptr_t{1});
+  }
+
+  const Hash &hash_function() const { return *this; }
+  const KeyEqual &key_eq() const { return *this; }
+
+  std::uint64_t hash_of(const key_type &key) const {
+    return hash_detail::mix(hash_function()(key));
+  }
+
+  // Power of two, at least one bucket per stripe, at most 3/4 full.
+  static size_type buckets_for(size_type count) {
+    size_type buckets = kStripes;
+    while (buckets * 3 / 4 < count) buckets <<= 1;
+    return buckets;
+  }
+
+  // The chain of hash in the newest table that already holds it, read
+  // once so a migration cannot swap in the marker afterwards.
+  static Node *head_of(const Table *table, std::uint64_t hash) {
+    for (;;) {
+      Node *head = table->buckets[hash & (table->count - 1)].load(
+          std::memory_order_acquire);
+      if (head != moved()) return head;
+      table = table->next.load(std::memory_order_acquire);
+    }
+  }
+
+  // The same for writers, who hold the stripe lock that migrate needs, so
+  // the bucket stays put. The stripe of a bucket is the same in every
+  // table size, since each is a multiple of kStripes.
+  static Link &bucket_of(Table *table, std::uint64_t hash) {
+    for (;;) {
+      Link &link = table->buckets[hash & (table->count - 1)];
+      if (link.load(std::memory_order_acquire) != moved()) return link;
+      table = table->next.load(std::memory_order_acquire);
+    }
+  }
+
+  std::mutex &stripe_of(std::uint64_t hash) {
+    return stripes_[hash & (kStripes - 1)].mutex;
+  }
+
+  template <typename F>
+  void visit_bucket(Table *table, size_type index, F &f) const {
+    Node *node = table->buckets[index].load(std::memory_order_acquire);
+    if (node == moved()) {
+      Table *next = table->next.load(std::memory_order_acquire);
+      visit_bucket(next, index, f);
+      visit_bucket(next, index + table->count, f);
+      return;
+    }
+    for (; node; node = node->next.load(std::memory_order_acquire)) {
+      f(node->key, node->value);
+    }
+  }
+
+  // Runs change(link, found, hash) under the key's stripe lock, where
+  // found is the node holding key or null, and link is the pointer to
+  // found or the bucket head. change returns the change in size.
+  // Afterwards the write does its share of any running resize.
+  template <typename Change>
+  int write(const key_type &key, Change change) {
+    epoch::Guard guard = epoch::pin();
+    std::uint64_t hash = hash_of(key);
+    int delta;
+    {
+      std::lock_guard<std::mutex> lock(stripe_of(hash));
+      Table *table = table_.load(std::memory_order_acquire);
+      Link &head = bucket_of(table, hash);
+      Link *link = &head;
+      Node *found = link->load(std::memory_order_relaxed);
+      while (found && !(found->hash == hash && key_eq()(found->key, key))) {
+        link = &found->next;
+        found = link->load(std::memory_order_relaxed);
+      }
+      delta = change(found ? *link : head, found, hash);
+    }
+    if (delta < 0) size_.fetch_sub(1, std::memory_order_relaxed);
+    if (delta > 0) {
+      size_type size = size_.fetch_add(1, std::memory_order_relaxed) + 1;
+      Table *table = table_.load(std::memory_order_acquire);
+      if (size > table->count * 3 / 4) start_resize(table);
+    }
+    help_resize();
+    return delta;
+  }
+
+  void start_resize(Table *table) {
+    if (table->next.load(std::memory_order_acquire)) return;
+    Table *bigger = new Table(table->count * 2);
+    Table *expected = nullptr;
+    if (!table->next.compare_exchange_strong(expected, bigger,
+                                             std::memory_order_acq_rel)) {
+      delete bigger;
+    }
+  }
+
+  // Migrates one batch of buckets of the running resize. False if there
+  // was nothing left to claim.
+  bool help_resize() {
+    Table *table = table_.load(std::memory_order_acquire);
+    Table *next = table->next.load(std::memory_order_acquire);
+    if (!next) return false;
+    size_type first =
+        table->claimed.fetch_add(kMigrateBatch, std::memory_order_relaxed);
+    if (first >= table->count) return false;
+    size_type last = std::min(first + kMigrateBatch, table->count);
+    for (size_type i = first; i < last; ++i) migrate(table, next, i);
+    size_type done = last - first;
+    if (table->migrated.fetch_add(done, std::memory_order_acq_rel) + done ==
+        table->count) {
+      table_.store(next, std::memory_order_release);
+      epoch::retire(table);
+    }
+    return true;
+  }
+
+  // Splits bucket index into buckets index and index + count of next.
+  // Nodes are immutable, so the chains are rebuilt from copies and the old
+  // nodes retired; readers keep walking the old chain meanwhile.
+  void migrate(Table *table, Table *next, size_type index) {
+    std::lock_guard<std::mutex> lock(stripe_of(index));
+    Node *node = table->buckets[index].load(std::memory_order_relaxed);
+    Node *low = nullptr;
+    Node *high = nullptr;
+    for (Node *it = node; it; it = it->next.load(std::memory_order_relaxed)) {
+      Node *&chain = it->hash & table->count ? high : low;
+      chain = new Node(it->hash, it->key, it->value, chain);
+    }
+    next->buckets[index].store(low, std::memory_order_release);
+    next->buckets[index + table->count].store(high, std::memory_order_release);
+    table->buckets[index].store(moved(), std::memory_order_release);
+    while (node) {
+      Node *after = node->next.load(std::memory_order_relaxed);
+      epoch::retire(node);
+      node = after;
+    }
+  }
+
+  s21::Vector<Stripe> stripes_;
+  std::atomic<Table *> table_;
+  std::atomic<size_type> size_;
+};
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_CONCURRENT_HASH_MAP_H
@@ -0,0 +1,262 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_CONCURRENT_MAP_H
+#define CPP2_S21_CONTAINERS_SRC_CONCURRENT_MAP_H
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <shared_mutex>
+#include <utility>
+
+#include "s21_map.h"
+#include "s21_priority_queue.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// Map split into independently locked shards, each an AVL-backed s21::Map.
+// A key's hash picks its shard, so operations on different shards never
+// wait for each other, and readers of one shard share its lock. Ordered
+// iteration read-locks every shard and merges their in-order walks.
+template <typename Key, typename T, typename Hash = std::hash<Key>,
+          typename Compare = std::less<Key>>
+class ConcurrentMap {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using size_type = std::size_t;
+  using map_type = s21::Map<key_type, mapped_type, Compare>;
+
+  static constexpr size_type kDefaultShards = 64;
+
+  explicit ConcurrentMap(size_type shards = kDefaultShards,
+                         const Hash &hash = Hash(),
+                         const Compare &comp = Compare())
+      : shards_(round_up(shards)),
+        mask_(shards_.size() - 1),
+        hash_(hash),
+        comp_(comp) {
+    for (Shard &shard : shards_) shard.map = map_type(comp);
+  }
+
+  ConcurrentMap(const ConcurrentMap &) = delete;
+  ConcurrentMap &operator=(const ConcurrentMap &) = delete;
+
+  // Sum of per-shard counts; exact only while no writer runs.
+  size_type size() const {
+    size_type total = 0;
+    for (const Shard &shard : shards_) {
+      total += shard.size.load(std::memory_order_relaxed);
+    }
+    return total;
+  }
+
+  bool empty() const { return size() == 0; }
+  size_type shard_count() const { return shards_.size(); }
+
+  // ---------------- Lookup ---------------------
+
+  bool contains(const key_type &key) const {
+    const Shard &shard = shard_of(key);
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    return shard.map.contains(key);
+  }
+
+  // Copies the value out, so it stays usable after the shard is unlocked.
+  bool find(const key_type &key, mapped_type &out) const {
+    return visit(key, [&out](const mapped_type &value) { out = value; });
+  }
+
+  // Calls f(const mapped_type &) under the shard's read lock.
+  template <typename F>
+  bool visit(const key_type &key, F f) const {
+    const Shard &shard = shard_of(key);
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    auto it = shard.map.find(key);
+    if (it == shard.map.end()) return false;
+    f((*it).second);
+    return true;
+  }
+
+  // ---------------- Modifiers ---------------------
+
+  bool insert(const key_type &key, const mapped_type &obj) {
+    Shard &shard = shard_of(key);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    return shard.publish(shard.map.try_emplace(key, obj).second);
+  }
+
+  // Returns true if key was absent.
+  bool insert_or_assign(const key_type &key, const mapped_type &obj) {
+    Shard &shard = shard_of(key);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    return shard.publish(shard.map.insert_or_assign(key, obj).second);
+  }
+
+  bool erase(const key_type &key) {
+    Shard &shard = shard_of(key);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    auto it = shard.map.find(key);
+    if (it == shard.map.end()) return false;
+    shard.map.erase(it);
+    shard.size.store(shard.map.size(), std::memory_order_relaxed);
+    return true;
+  }
+
+  // Returns the value for key, first storing make(key) if there is none.
+  // A present key costs only the read lock; make runs at most once per
+  // insertion, under the shard's write lock, so it must not use this map.
+  template <typename Make>
+  mapped_type compute_if_absent(const key_type &key, Make make) {
+    Shard &shard = shard_of(key);
+    {
+      std::shared_lock<std::shared_mutex> lock(shard.mutex);
+      auto it = shard.map.find(key);
+      if (it != shard.map.end()) return (*it).second;
+    }
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    auto it = shard.map.find(key);
+    if (it == shard.map.end()) {
+      it = shard.map.try_emplace(key, make(key)).first;
+      shard.publish(true);
+    }
+    return (*it).second;
+  }
+
+  // Applies f(mapped_type &) to the value for key under the shard's write
+  // lock, so read-modify-write sequences are atomic. False if key is absent.
+  template <typename F>
+  bool update(const key_type &key, F f) {
+    Shard &shard = shard_of(key);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    auto it = shard.map.find(key);
+    if (it == shard.map.end()) return false;
+    f((*it).second);
+    return true;
+  }
+
+  void clear() {
+    for (Shard &shard : shards_) {
+      std::unique_lock<std::shared_mutex> lock(shard.mutex);
+      shard.map.clear();
+      shard.size.store(0, std::memory_order_relaxed);
+    }
+  }
+
+  // ---------------- Ordered iteration ---------------------
+
+  // Calls f(const value_type &) for every element in key order. All shards
+  // are read-locked for the duration, so f sees one consistent state and
+  // must not write to this map.
+  template <typename F>
+  void for_each(F f) const {
+    ReadLocks locks(shards_);
+    Merge merge(comp_);
+    for (Shard &shard : shards_) {
+      merge.add(shard.map.begin(), shard.map.end());
+    }
+    merge.run(f);
+  }
+
+  // Same for keys in [lo, hi).
+  template <typename F>
+  void for_each_range(const key_type &lo, const key_type &hi, F f) const {
+    ReadLocks locks(shards_);
+    Merge merge(comp_);
+    for (Shard &shard : shards_) {
+      merge.add(shard.map.lower_bound(lo), shard.map.lower_bound(hi));
+    }
+    merge.run(f);
+  }
+
+ private:
+  using iterator = typename map_type::iterator;
+
+  struct alignas(64) Shard {
+    // Stores the new size after an insertion attempt and passes its
+    // outcome through.
+    bool publish(bool inserted) {
+      if (inserted) size.store(map.size(), std::memory_order_relaxed);
+      return inserted;
+    }
+
+    mutable std::shared_mutex mutex;
+    // s21::Map lookups are not const-qualified but do not modify the tree.
+    mutable map_type map;
+    std::atomic<size_type> size{0};
+  };
+
+  class ReadLocks {
+   public:
+    explicit ReadLocks(const s21::Vector<Shard> &shards) : shards_(shards) {
+      for (const Shard &shard : shards_) shard.mutex.lock_shared();
+    }
+    ~ReadLocks() {
+      for (const Shard &shard : shards_) shard.mutex.unlock_shared();
+    }
+
+   private:
+    const s21::Vector<Shard> &shards_;
+  };
+
+  struct Cursor {
+    iterator it;
+    iterator end;
+    const value_type *value;
+  };
+
+  // Orders cursors so that the heap's top is the one with the least key.
+  struct CursorAfter {
+    bool operator()(const Cursor &a, const Cursor &b) const {
+      return comp(b.value->first, a.value->first);
+    }
+    Compare comp;
+  };
+
+  class Merge {
+   public:
+    explicit Merge(const Compare &comp) : heap_(CursorAfter{comp}) {}
+
+    void add(iterator first, iterator last) {
+      if (first != last) heap_.push(Cursor{first, last, &*first});
+    }
+
+    template <typename F>
+    void run(F &f) {
+      while (!heap_.empty()) {
+        Cursor cursor = heap_.top();
+        heap_.pop();
+        f(*cursor.value);
+        if (++cursor.it != cursor.end) {
+          cursor.value = &*cursor.it;
+          heap_.push(cursor);
+        }
+      }
+    }
+
+   private:
+    s21::PriorityQueue<Cursor, s21::Vector<Cursor>, CursorAfter, 4> heap_;
+  };
+
+  static size_type round_up(size_type count) {
+    size_type power = 1;
+    while (power < count) power <<= 1;
+    return power;
+  }
+
+  // The hash is mixed first so identity hashes of sequential keys still
+  // spread over all shards.
+  Shard &shard_of(const key_type &key) const {
+    std::uint64_t h = static_cast<std::uint64_t>(hash_(key));
+    h *= 0x9E3779B97F4A7C15ull;
+    return shards_[(h >> 32) & mask_];
+  }
+
+  s21::Vector<Shard> shards_;
+  size_type mask_;
+  Hash hash_;
+  Compare comp_;
+};
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_CONCURRENT_MAP_H
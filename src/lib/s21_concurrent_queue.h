@@ -0,0 +1,231 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_CONCURRENT_QUEUE_H
+#define CPP2_S21_CONTAINERS_SRC_CONCURRENT_QUEUE_H
+
+#include <chrono>
+#include <condition_variable>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+
+#include "s21_queue.h"
+
+namespace s21 {
+template <typename T, typename Container = s21::List<T>>
+class ConcurrentQueue {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+
+  ConcurrentQueue() : ConcurrentQueue(std::numeric_limits<size_type>::max()) {}
+
+  explicit ConcurrentQueue(size_type capacity)
+      : capacity_(capacity), closed_(false), push_waiters_(0), pop_waiters_(0) {
+    if (capacity_ == 0) {
+      throw std::invalid_argument("ConcurrentQueue capacity must be positive");
+    }
+  }
+
+  ConcurrentQueue(const ConcurrentQueue &) = delete;
+  ConcurrentQueue &operator=(const ConcurrentQueue &) = delete;
+  ~ConcurrentQueue() {}
+
+  // ---------------- Producers ---------------------
+
+  // Blocks while the queue is full. Returns false once the queue is closed.
+  bool push(const_reference value) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    wait_not_full(lock);
+    return push_locked(lock, value);
+  }
+
+  bool push(value_type &&value) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    wait_not_full(lock);
+    return push_locked(lock, std::move(value));
+  }
+
+  bool try_push(value_type value) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    return push_locked(lock, std::move(value));
+  }
+
+  template <class Rep, class Period>
+  bool push_for(value_type value,
+                const std::chrono::duration<Rep, Period> &timeout) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    ++push_waiters_;
+    not_full_.wait_for(lock, timeout, [this] { return has_space(); });
+    --push_waiters_;
+    return push_locked(lock, std::move(value));
+  }
+
+  // Moves [first, last) in under as few lock acquisitions as capacity allows
+  // and wakes consumers once per acquisition. Returns the number pushed.
+  template <typename InputIt>
+  size_type push_bulk(InputIt first, InputIt last) {
+    size_type pushed = 0;
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (first != last) {
+      wait_not_full(lock);
+      if (closed_) break;
+      size_type batch = 0;
+      for (; first != last && has_space(); ++first, ++batch) {
+        queue_.push(std::move(*first));
+      }
+      pushed += batch;
+      wake_consumers(batch);
+    }
+    return pushed;
+  }
+
+  // ---------------- Consumers ---------------------
+
+  // Blocks while the queue is empty. Returns false once the queue is closed
+  // and fully drained.
+  bool pop(reference out) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    wait_not_empty(lock);
+    return pop_locked(out);
+  }
+
+  bool try_pop(reference out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return pop_locked(out);
+  }
+
+  template <class Rep, class Period>
+  bool pop_for(reference out,
+               const std::chrono::duration<Rep, Period> &timeout) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    ++pop_waiters_;
+    not_empty_.wait_for(lock, timeout,
+                        [this] { return !queue_.empty() || closed_; });
+    --pop_waiters_;
+    return pop_locked(out);
+  }
+
+  // Waits for at least one element and moves up to max of them to out in a
+  // single critical section. Returns 0 only when closed and drained.
+  template <typename OutputIt>
+  size_type pop_bulk(OutputIt out, size_type max) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    wait_not_empty(lock);
+    return drain_locked(out, max);
+  }
+
+  template <typename OutputIt, class Rep, class Period>
+  size_type pop_bulk_for(OutputIt out, size_type max,
+                         const std::chrono::duration<Rep, Period> &timeout) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    ++pop_waiters_;
+    not_empty_.wait_for(lock, timeout,
+                        [this] { return !queue_.empty() || closed_; });
+    --pop_waiters_;
+    return drain_locked(out, max);
+  }
+
+  template <typename OutputIt>
+  size_type try_pop_bulk(OutputIt out, size_type max) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return drain_locked(out, max);
+  }
+
+  // ---------------- Shutdown ---------------------
+
+  // Rejects further pushes and releases every blocked thread. Elements
+  // already queued can still be popped.
+  void close() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      closed_ = true;
+    }
+    not_full_.notify_all();
+    not_empty_.notify_all();
+  }
+
+  bool closed() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return closed_;
+  }
+
+  // ---------------- Capacity ---------------------
+
+  bool empty() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return queue_.empty();
+  }
+
+  size_type size() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return queue_.size();
+  }
+
+  size_type capacity() const noexcept { return capacity_; }
+
+ private:
+  bool has_space() { return closed_ || queue_.size() < capacity_; }
+
+  void wait_not_full(std::unique_lock<std::mutex> &lock) {
+    if (has_space()) return;
+    ++push_waiters_;
+    not_full_.wait(lock, [this] { return has_space(); });
+    --push_waiters_;
+  }
+
+  void wait_not_empty(std::unique_lock<std::mutex> &lock) {
+    if (!queue_.empty() || closed_) return;
+    ++pop_waiters_;
+    not_empty_.wait(lock, [this] { return !queue_.empty() || closed_; });
+    --pop_waiters_;
+  }
+
+  template <typename U>
+  bool push_locked(std::unique_lock<std::mutex> &lock, U &&value) {
+    if (closed_ || queue_.size() >= capacity_) return false;
+    queue_.push(std::forward<U>(value));
+    bool wake = pop_waiters_ > 0;
+    lock.unlock();
+    if (wake) not_empty_.notify_one();
+    return true;
+  }
+
+  bool pop_locked(reference out) {
+    if (queue_.empty()) return false;
+    out = std::move(queue_.front());
+    queue_.pop();
+    if (push_waiters_ > 0) not_full_.notify_one();
+    return true;
+  }
+
+  template <typename OutputIt>
+  size_type drain_locked(OutputIt out, size_type max) {
+    size_type count = 0;
+    for (; count < max && !queue_.empty(); ++count, ++out) {
+      *out = std::move(queue_.front());
+      queue_.pop();
+    }
+    if (count > 0 && push_waiters_ > 0) {
+      count == 1 ? not_full_.notify_one() : not_full_.notify_all();
+    }
+    return count;
+  }
+
+  void wake_consumers(size_type batch) {
+    if (batch == 0 || pop_waiters_ == 0) return;
+    batch == 1 ? not_empty_.notify_one() : not_empty_.notify_all();
+  }
+
+  s21::Queue<value_type, Container> queue_;
+  const size_type capacity_;
+  bool closed_;
+  size_type push_waiters_;
+  size_type pop_waiters_;
+  std::mutex mutex_;
+  std::condition_variable not_full_;
+  std::condition_variable not_empty_;
+};
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_CONCURRENT_QUEUE_H
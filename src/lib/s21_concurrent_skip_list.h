@@ -0,0 +1,504 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_CONCURRENT_SKIP_LIST_H
+#define CPP2_S21_CONTAINERS_SRC_CONCURRENT_SKIP_LIST_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_epoch.h"
+
+namespace s21 {
+// Lock-free ordered list of unique keys. Every level is a sorted linked
+// list whose links carry a deletion mark in their low bit; an element is
+// present while its level-0 link is unmarked. Inserts link bottom-up with
+// CAS, erases mark top-down and leave the unlinking to whoever passes by.
+// A node is retired to s21::epoch only after both its inserter and its
+// remover are done with it and it has been unlinked from every level.
+template <typename Value, typename KeyOf, typename Compare>
+class ConcurrentSkipList : private Compare {
+  using Link = std::atomic<std::uintptr_t>;
+
+  struct alignas(Link) Node {
+    explicit Node(int levels) : height(levels), pending(2) {
+      for (int level = 0; level < height; ++level) new (&next(level)) Link(0);
+    }
+
+    Link &next(int level) { return reinterpret_cast<Link *>(this + 1)[level]; }
+    Value &value() { return *reinterpret_cast<Value *>(storage); }
+
+    int height;
+    // The inserter and the remover; the last one out retires the node.
+    std::atomic<int> pending;
+    alignas(Value) unsigned char storage[sizeof(Value)];
+  };
+
+ public:
+  using size_type = std::size_t;
+
+  static constexpr int kMaxHeight = 20;
+
+  class Iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Value;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const Value *;
+    using reference = const Value &;
+
+    Iterator() : node_(nullptr) {}
+    Iterator(const Iterator &other) : Iterator(other.node_) {}
+    Iterator(Iterator &&other) noexcept = default;
+
+    Iterator &operator=(Iterator other) noexcept {
+      std::swap(node_, other.node_);
+      std::swap(guard_, other.guard_);
+      return *this;
+    }
+
+    const Value &operator*() const { return node_->value(); }
+    const Value *operator->() const { return &node_->value(); }
+
+    // Steps to the next element still present, so a concurrent erase is
+    // either seen or skipped, never half-seen.
+    Iterator &operator++() {
+      node_ = live_from(successor(node_, 0));
+      if (!node_) guard_ = epoch::Guard();
+      return *this;
+    }
+
+    bool operator==(const Iterator &other) const {
+      return node_ == other.node_;
+    }
+    bool operator!=(const Iterator &other) const {
+      return node_ != other.node_;
+    }
+
+   private:
+    friend class ConcurrentSkipList;
+
+    // The caller is pinned already; the iterator pins again so the node
+    // outlives that scope.
+    explicit Iterator(Node *node)
+        : node_(node), guard_(node ? epoch::pin() : epoch::Guard()) {}
+
+    Node *node_;
+    epoch::Guard guard_;
+  };
+
+  explicit ConcurrentSkipList(const Compare &comp = Compare())
+      : Compare(comp), head_(create_head()), levels_(1), size_(0) {}
+
+  ConcurrentSkipList(const ConcurrentSkipList &) = delete;
+  ConcurrentSkipList &operator=(const ConcurrentSkipList &) = delete;
+
+  // No other thread may use the list any more; nodes already retired are
+  // freed by the epoch domain.
+  ~ConcurrentSkipList() {
+    Node *node = successor(head_, 0);
+    while (node) {
+      Node *next = pointer_of(node->next(0).load(std::memory_order_relaxed));
+      destroy(node);
+      node = next;
+    }
+    ::operator delete(head_);
+  }
+
+  // Exact once writers have stopped.
+  size_type size() const { return size_.load(std::memory_order_relaxed); }
+  bool empty() const { return size() == 0; }
+
+  const Compare &key_comp() const { return *this; }
+
+  template <typename K, typename... Args>
+  bool emplace(const K &key, Args &&...args) {
+    epoch::Guard guard = epoch::pin();
+    Node *preds[kMaxHeight];
+    Node *succs[kMaxHeight];
+    int height = random_height();
+    Node *node = nullptr;
+    for (;;) {
+      if (find(key, preds, succs)) {
+        if (node) destroy(node);
+        return false;
+      }
+      if (!node) node = create(height, std::forward<Args>(args)...);
+      for (int level = 0; level < height; ++level) {
+        node->next(level).store(link_of(succs[level]),
+                                std::memory_order_relaxed);
+      }
+      std::uintptr_t expected = link_of(succs[0]);
+      if (preds[0]->next(0).compare_exchange_strong(
+              expected, link_of(node), std::memory_order_acq_rel)) {
+        break;
+      }
+    }
+    size_.fetch_add(1, std::memory_order_relaxed);
+    raise_levels(height);
+    link_upper(key, node, preds, succs);
+    drop(node);
+    return true;
+  }
+
+  template <typename K>
+  bool erase(const K &key) {
+    epoch::Guard guard = epoch::pin();
+    Node *preds[kMaxHeight];
+    Node *succs[kMaxHeight];
+    if (!find(key, preds, succs)) return false;
+    Node *node = succs[0];
+    for (int level = node->height - 1; level > 0; --level) mark(node, level);
+    std::uintptr_t link = node->next(0).load(std::memory_order_acquire);
+    while (!(link & kMarked)) {
+      if (node->next(0).compare_exchange_weak(link, link | kMarked,
+                                              std::memory_order_acq_rel)) {
+        size_.fetch_sub(1, std::memory_order_relaxed);
+        drop(node);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  template <typename K>
+  bool contains(const K &key) const {
+    epoch::Guard guard = epoch::pin();
+    Node *node = seek(key);
+    return node && !less(key, KeyOf()(node->value()));
+  }
+
+  template <typename K>
+  Iterator find(const K &key) const {
+    epoch::Guard guard = epoch::pin();
+    Node *node = seek(key);
+    if (!node || less(key, KeyOf()(node->value()))) return Iterator();
+    return Iterator(node);
+  }
+
+  template <typename K>
+  Iterator lower_bound(const K &key) const {
+    epoch::Guard guard = epoch::pin();
+    return Iterator(seek(key));
+  }
+
+  Iterator begin() const {
+    epoch::Guard guard = epoch::pin();
+    return Iterator(live_from(successor(head_, 0)));
+  }
+
+  Iterator end() const { return Iterator(); }
+
+ private:
+  static constexpr std::uintptr_t kMarked = 1;
+
+  static Node *pointer_of(std::uintptr_t link) {
+    return reinterpret_cast<Node *>(link & ~kMarked);
+  }
+
+  static std::uintptr_t link_of(Node *node) {
+    return reinterpret_cast<std::uintptr_t>(node);
+  }
+
+  static Node *successor(Node *node, int level) {
+    return pointer_of(node->next(level).load(std::memory_order_acquire));
+  }
+
+  static Node *allocate(int height) {
+    void *raw = ::operator new(sizeof(Node) + height * sizeof(Link));
+    return new (raw) Node(height);
+  }
+
+  static Node *create_head() { return allocate(kMaxHeight); }
+
+  template <typename... Args>
+  static Node *create(int height, Args &&...args) {
+    Node *node = allocate(height);
+    try {
+      new (node->storage) Value(std::forward<Args>(args)...);
+    } catch (...) {
+      ::operator delete(node);
+      throw;
+    }
+    return node;
+  }
+
+  static void destroy(void *ptr) {
+    Node *node = static_cast<Node *>(ptr);
+    node->value().~Value();
+    ::operator delete(node);
+  }
+
+  // First node at or after node whose element is still present.
+  static Node *live_from(Node *node) {
+    while (node &&
+           (node->next(0).load(std::memory_order_acquire) & kMarked)) {
+      node = successor(node, 0);
+    }
+    return node;
+  }
+
+  template <typename A, typename B>
+  bool less(const A &a, const B &b) const {
+    return key_comp()(a, b);
+  }
+
+  // Geometric with p = 1/4, from a per-thread xorshift generator.
+  static int random_height() {
+    static thread_local std::uint64_t state =
+        0x9E3779B97F4A7C15ull ^
+        reinterpret_cast<std::uintptr_t>(&state);
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    int height = 1;
+    for (std::uint64_t bits = state; height < kMaxHeight && (bits & 3) == 0;
+         bits >>= 2) {
+      ++height;
+    }
+    return height;
+  }
+
+  void raise_levels(int height) {
+    int levels = levels_.load(std::memory_order_relaxed);
+    while (levels < height && !levels_.compare_exchange_weak(
+                                  levels, height, std::memory_order_relaxed)) {
+    }
+  }
+
+  // Read-only descent to the first present node with a key not ordered
+  // before key. Marked nodes are stepped over, not unlinked.
+  template <typename K>
+  Node *seek(const K &key) const {
+    Node *pred = head_;
+    Node *curr = nullptr;
+    for (int level = levels_.load(std::memory_order_relaxed) - 1; level >= 0;
+         --level) {
+      curr = successor(pred, level);
+      while (curr) {
+        std::uintptr_t succ = curr->next(level).load(std::memory_order_acquire);
+        if (succ & kMarked) {
+          curr = pointer_of(succ);
+        } else if (less(KeyOf()(curr->value()), key)) {
+          pred = curr;
+          curr = pointer_of(succ);
+        } else {
+          break;
+        }
+      }
+    }
+    return curr;
+  }
+
+  // Fills preds and succs on every level around the first node with a key
+  // not ordered before key, unlinking marked nodes on the way. True if
+  // succs[0] holds key.
+  template <typename K>
+  bool find(const K &key, Node **preds, Node **succs) {
+  retry:
+    Node *pred = head_;
+    Node *curr = nullptr;
+    for (int level = kMaxHeight - 1; level >= 0; --level) {
+      curr = successor(pred, level);
+      while (curr) {
+        std::uintptr_t succ = curr->next(level).load(std::memory_order_acquire);
+        if (succ & kMarked) {
+          std::uintptr_t expected = link_of(curr);
+          if (!pred->next(level).compare_exchange_strong(
+                  expected, succ & ~kMarked, std::memory_order_acq_rel)) {
+            goto retry;
+          }
+          curr = pointer_of(succ);
+        } else if (less(KeyOf()(curr->value()), key)) {
+          pred = curr;
+          curr = pointer_of(succ);
+        } else {
+          break;
+        }
+      }
+      preds[level] = pred;
+      succs[level] = curr;
+    }
+    return curr && !less(key, KeyOf()(curr->value()));
+  }
+
+  // Links node into levels 1 and up, stopping early if it gets erased.
+  template <typename K>
+  void link_upper(const K &key, Node *node, Node **preds, Node **succs) {
+    for (int level = 1; level < node->height; ++level) {
+      for (;;) {
+        std::uintptr_t link = node->next(level).load(std::memory_order_acquire);
+        if (link & kMarked) return;
+        Node *succ = succs[level];
+        if (pointer_of(link) != succ &&
+            !node->next(level).compare_exchange_strong(
+                link, link_of(succ), std::memory_order_acq_rel)) {
+          continue;
+        }
+        std::uintptr_t expected = link_of(succ);
+        if (preds[level]->next(level).compare_exchange_strong(
+                expected, link_of(node), std::memory_order_acq_rel)) {
+          break;
+        }
+        if (!find(key, preds, succs) || succs[0] != node) return;
+      }
+    }
+  }
+
+  static void mark(Node *node, int level) {
+    std::uintptr_t link = node->next(level).load(std::memory_order_acquire);
+    while (!(link & kMarked) &&
+           !node->next(level).compare_exchange_weak(
+               link, link | kMarked, std::memory_order_acq_rel)) {
+    }
+  }
+
+  void drop(Node *node) {
+    if (node->pending.fetch_sub(1, std::memory_order_acq_rel) != 1) return;
+    unlink(node);
+    epoch::retire(node, &destroy, sizeof(Node) + node->height * sizeof(Link));
+  }
+
+  // Unlinks an erased node, whose links are all marked by now, from every
+  // level. The descent starts at the top so it stays O(log n), and equal
+  // keys are passed as well, since a newer element with the same key may
+  // sit in front of the node.
+  void unlink(Node *node) {
+    const auto &key = KeyOf()(node->value());
+  retry:
+    Node *start = head_;
+    for (int level = levels_.load(std::memory_order_relaxed) - 1; level >= 0;
+         --level) {
+      Node *pred = start;
+      Node *curr = successor(pred, level);
+      while (curr) {
+        std::uintptr_t succ = curr->next(level).load(std::memory_order_acquire);
+        if (succ & kMarked) {
+          std::uintptr_t expected = link_of(curr);
+          if (!pred->next(level).compare_exchange_strong(
+                  expected, succ & ~kMarked, std::memory_order_acq_rel)) {
+            goto retry;
+          }
+          if (curr == node) break;
+          curr = pointer_of(succ);
+        } else if (!less(key, KeyOf()(curr->value()))) {
+          if (less(KeyOf()(curr->value()), key)) start = curr;
+          pred = curr;
+          curr = pointer_of(succ);
+        } else {
+          break;
+        }
+      }
+    }
+  }
+
+  Node *head_;
+  std::atomic<int> levels_;
+  std::atomic<size_type> size_;
+};
+
+template <typename Key, typename T>
+struct SkipListMapKey {
+  const Key &operator()(const std::pair<const Key, T> &value) const {
+    return value.first;
+  }
+};
+
+struct SkipListSetKey {
+  template <typename Key>
+  const Key &operator()(const Key &value) const {
+    return value;
+  }
+};
+
+// Lock-free ordered set. Iterators pin the calling thread's epoch, so the
+// element they point at stays readable; they must not leave that thread.
+template <typename Key, typename Compare = std::less<Key>>
+class ConcurrentSkipListSet {
+  using list_type = ConcurrentSkipList<Key, SkipListSetKey, Compare>;
+
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using size_type = std::size_t;
+  using iterator = typename list_type::Iterator;
+  using const_iterator = iterator;
+
+  explicit ConcurrentSkipListSet(const Compare &comp = Compare())
+      : list_(comp) {}
+
+  size_type size() const { return list_.size(); }
+  bool empty() const { return list_.empty(); }
+
+  bool insert(const value_type &value) { return list_.emplace(value, value); }
+  bool erase(const key_type &key) { return list_.erase(key); }
+
+  bool contains(const key_type &key) const { return list_.contains(key); }
+  iterator find(const key_type &key) const { return list_.find(key); }
+  iterator lower_bound(const key_type &key) const {
+    return list_.lower_bound(key);
+  }
+
+  iterator begin() const { return list_.begin(); }
+  iterator end() const { return list_.end(); }
+
+ private:
+  list_type list_;
+};
+
+// Lock-free ordered map. Values are fixed once inserted; replace one by
+// erasing and inserting again.
+template <typename Key, typename T, typename Compare = std::less<Key>>
+class ConcurrentSkipListMap {
+  using list_type =
+      ConcurrentSkipList<std::pair<const Key, T>, SkipListMapKey<Key, T>,
+                         Compare>;
+
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using size_type = std::size_t;
+  using iterator = typename list_type::Iterator;
+  using const_iterator = iterator;
+
+  explicit ConcurrentSkipListMap(const Compare &comp = Compare())
+      : list_(comp) {}
+
+  size_type size() const { return list_.size(); }
+  bool empty() const { return list_.empty(); }
+
+  bool insert(const value_type &value) {
+    return list_.emplace(value.first, value);
+  }
+
+  bool insert(const key_type &key, const mapped_type &obj) {
+    return list_.emplace(key, key, obj);
+  }
+
+  bool erase(const key_type &key) { return list_.erase(key); }
+
+  bool contains(const key_type &key) const { return list_.contains(key); }
+  iterator find(const key_type &key) const { return list_.find(key); }
+  iterator lower_bound(const key_type &key) const {
+    return list_.lower_bound(key);
+  }
+
+  mapped_type at(const key_type &key) const {
+    iterator it = find(key);
+    if (it == end()) throw std::out_of_range("Key does not exist!");
+    return it->second;
+  }
+
+  iterator begin() const { return list_.begin(); }
+  iterator end() const { return list_.end(); }
+
+ private:
+  list_type list_;
+};
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_CONCURRENT_SKIP_LIST_H
@@ -0,0 +1,225 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_CONCURRENT_STACK_H
+#define CPP2_S21_CONTAINERS_SRC_CONCURRENT_STACK_H
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+namespace s21 {
+// Treiber stack. Nodes live in a never-shrinking pool of chunks and are
+// addressed by 32-bit indices, so the head fits a 64-bit word together with
+// an ABA tag, and a stale reader can always dereference a recycled node.
+// Under contention push and pop first try to meet in an elimination array
+// and hand the value over without touching the head.
+template <typename T>
+class ConcurrentStack {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+
+  ConcurrentStack() : head_(0), free_(0), next_index_(0) {
+    for (auto &chunk : chunks_) {
+      chunk.store(nullptr, std::memory_order_relaxed);
+    }
+    for (auto &slot : exchanger_) {
+      slot.value.store(0, std::memory_order_relaxed);
+    }
+  }
+
+  ConcurrentStack(const ConcurrentStack &) = delete;
+  ConcurrentStack &operator=(const ConcurrentStack &) = delete;
+
+  ~ConcurrentStack() {
+    for (std::uint32_t link = link_of(head_.load()); link;) {
+      Node *node = at(link);
+      value(node)->~value_type();
+      link = node->next.load(std::memory_order_relaxed);
+    }
+    for (std::size_t k = 0; k < kChunks; ++k) {
+      delete[] chunks_[k].load(std::memory_order_relaxed);
+    }
+  }
+
+  // ---------------- Modifiers ---------------------
+
+  void push(const_reference value) { emplace(value); }
+  void push(value_type &&value) { emplace(std::move(value)); }
+
+  template <class... Args>
+  void emplace(Args &&...args) {
+    std::uint32_t link = allocate();
+    Node *node = at(link);
+    new (node->storage) value_type(std::forward<Args>(args)...);
+    for (unsigned attempt = 0;; ++attempt) {
+      if (try_link(head_, link, node)) return;
+      if (offer(link, node->version, attempt)) return;
+    }
+  }
+
+  bool try_pop(reference out) {
+    for (unsigned attempt = 0;; ++attempt) {
+      std::uint64_t head = head_.load(std::memory_order_acquire);
+      std::uint32_t link = link_of(head);
+      if (!link) return false;
+      Node *node = at(link);
+      std::uint32_t next = node->next.load(std::memory_order_relaxed);
+      if (head_.compare_exchange_weak(head, pack(next, tag_of(head) + 1),
+                                      std::memory_order_acquire,
+                                      std::memory_order_relaxed)) {
+        take(link, out);
+        return true;
+      }
+      if ((link = accept(attempt)) != 0) {
+        take(link, out);
+        return true;
+      }
+    }
+  }
+
+  // ---------------- Capacity ---------------------
+
+  bool empty() const noexcept {
+    return link_of(head_.load(std::memory_order_acquire)) == 0;
+  }
+
+ private:
+  static constexpr std::size_t kFirstChunkBits = 6;
+  static constexpr std::size_t kChunks = 28;
+  static constexpr std::size_t kSlots = 8;
+  static constexpr int kOfferSpins = 128;
+
+  struct Node {
+    Node() : next(0), version(0) {}
+    std::atomic<std::uint32_t> next;
+    std::uint32_t version;
+    alignas(value_type) unsigned char storage[sizeof(value_type)];
+  };
+
+  struct alignas(64) Slot {
+    std::atomic<std::uint64_t> value;
+  };
+
+  static std::uint64_t pack(std::uint32_t link, std::uint32_t tag) {
+    return static_cast<std::uint64_t>(tag) << 32 | link;
+  }
+  static std::uint32_t link_of(std::uint64_t word) {
+    return static_cast<std::uint32_t>(word);
+  }
+  static std::uint32_t tag_of(std::uint64_t word) {
+    return static_cast<std::uint32_t>(word >> 32);
+  }
+  static value_type *value(Node *node) {
+    return std::launder(reinterpret_cast<value_type *>(node->storage));
+  }
+
+  // Link l names pool index l - 1; chunk k holds 64 << k nodes.
+  Node *at(std::uint32_t link) const {
+    std::uint64_t j = static_cast<std::uint64_t>(link - 1) +
+                      (std::uint64_t{1} << kFirstChunkBits);
+    std::size_t bit = 63 - static_cast<std::size_t>(__builtin_clzll(j));
+    std::size_t k = bit - kFirstChunkBits;
+    return chunks_[k].load(std::memory_order_acquire) +
+           (j - (std::uint64_t{1} << bit));
+  }
+
+  std::uint32_t allocate() {
+    std::uint64_t head = free_.load(std::memory_order_acquire);
+    while (link_of(head)) {
+      Node *node = at(link_of(head));
+      std::uint32_t next = node->next.load(std::memory_order_relaxed);
+      if (free_.compare_exchange_weak(head, pack(next, tag_of(head) + 1),
+                                      std::memory_order_acquire,
+                                      std::memory_order_acquire)) {
+        ++node->version;
+        return link_of(head);
+      }
+    }
+    std::uint64_t index = next_index_.fetch_add(1, std::memory_order_relaxed);
+    if (index >= UINT32_MAX) {
+      throw std::length_error("ConcurrentStack node pool is exhausted");
+    }
+    std::uint32_t link = static_cast<std::uint32_t>(index + 1);
+    std::uint64_t j = index + (std::uint64_t{1} << kFirstChunkBits);
+    std::size_t bit = 63 - static_cast<std::size_t>(__builtin_clzll(j));
+    std::atomic<Node *> &chunk = chunks_[bit - kFirstChunkBits];
+    if (!chunk.load(std::memory_order_acquire)) {
+      Node *fresh = new Node[std::size_t{1} << bit];
+      Node *expected = nullptr;
+      if (!chunk.compare_exchange_strong(expected, fresh,
+                                         std::memory_order_acq_rel)) {
+        delete[] fresh;
+      }
+    }
+    return link;
+  }
+
+  bool try_link(std::atomic<std::uint64_t> &list, std::uint32_t link,
+                Node *node) {
+    std::uint64_t head = list.load(std::memory_order_relaxed);
+    node->next.store(link_of(head), std::memory_order_relaxed);
+    return list.compare_exchange_strong(head, pack(link, tag_of(head) + 1),
+                                        std::memory_order_release,
+                                        std::memory_order_relaxed);
+  }
+
+  void take(std::uint32_t link, reference out) {
+    Node *node = at(link);
+    out = std::move(*value(node));
+    value(node)->~value_type();
+    while (!try_link(free_, link, node)) {
+    }
+  }
+
+  Slot &slot_for(unsigned attempt) {
+    static thread_local unsigned seed =
+        static_cast<unsigned>(std::hash<std::thread::id>{}(
+            std::this_thread::get_id()));
+    seed = seed * 1103515245u + 12345u + attempt;
+    return exchanger_[(seed >> 16) % kSlots];
+  }
+
+  // A pusher parks its node in a random slot for a short while. Returns true
+  // if a popper took it from there.
+  bool offer(std::uint32_t link, std::uint32_t version, unsigned attempt) {
+    Slot &slot = slot_for(attempt);
+    std::uint64_t empty = 0;
+    std::uint64_t mine = pack(link, version);
+    if (!slot.value.compare_exchange_strong(empty, mine,
+                                            std::memory_order_release,
+                                            std::memory_order_relaxed)) {
+      return false;
+    }
+    for (int i = 0; i < kOfferSpins; ++i) {
+      if (slot.value.load(std::memory_order_relaxed) != mine) return true;
+    }
+    return !slot.value.compare_exchange_strong(mine, 0,
+                                               std::memory_order_relaxed);
+  }
+
+  std::uint32_t accept(unsigned attempt) {
+    Slot &slot = slot_for(attempt);
+    std::uint64_t offered = slot.value.load(std::memory_order_acquire);
+    if (offered != 0 &&
+        slot.value.compare_exchange_strong(offered, 0,
+                                           std::memory_order_acquire,
+                                           std::memory_order_relaxed)) {
+      return link_of(offered);
+    }
+    return 0;
+  }
+
+  alignas(64) std::atomic<std::uint64_t> head_;
+  alignas(64) std::atomic<std::uint64_t> free_;
+  alignas(64) std::atomic<std::uint64_t> next_index_;
+  std::atomic<Node *> chunks_[kChunks];
+  Slot exchanger_[kSlots];
+};
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_CONCURRENT_STACK_H
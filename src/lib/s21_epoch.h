@@ -0,0 +1,357 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_EPOCH_H
+#define CPP2_S21_CONTAINERS_SRC_EPOCH_H
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+
+#include "s21_vector.h"
+
+namespace s21 {
+namespace epoch {
+using Deleter = void (*)(void *);
+
+class Domain;
+class Participant;
+
+struct Retired {
+  void *ptr;
+  Deleter deleter;
+  std::size_t bytes;
+};
+
+// Garbage retired during one epoch. Freed once the global epoch is two ahead.
+struct Bag {
+  Bag() : epoch(0), bytes(0) {}
+
+  void free_all() {
+    for (Retired &item : items) item.deleter(item.ptr);
+    items.clear();
+    bytes = 0;
+  }
+
+  std::uint64_t epoch;
+  std::size_t bytes;
+  s21::Vector<Retired> items;
+};
+
+namespace detail {
+constexpr std::uint64_t kPinned = 1;
+
+struct Record {
+  Record() : state(0), in_use(false), pending_bytes(0), pending_count(0) {}
+
+  // Global epoch observed at pin time shifted left by one, low bit = pinned.
+  std::atomic<std::uint64_t> state;
+  std::atomic<bool> in_use;
+  std::atomic<std::size_t> pending_bytes;
+  std::atomic<std::size_t> pending_count;
+  Record *next = nullptr;
+  unsigned nesting = 0;
+  std::size_t since_collect = 0;
+  Bag bags[3];
+};
+}  // namespace detail
+
+// Pins the owning participant for its lifetime. Nested guards are allowed.
+class Guard {
+ public:
+  Guard() : owner_(nullptr) {}
+  explicit Guard(Participant *owner);
+  Guard(const Guard &) = delete;
+  Guard &operator=(const Guard &) = delete;
+  Guard(Guard &&other) noexcept : owner_(other.owner_) {
+    other.owner_ = nullptr;
+  }
+  Guard &operator=(Guard &&other) noexcept {
+    std::swap(owner_, other.owner_);
+    return *this;
+  }
+  ~Guard();
+
+  void retire(void *ptr, Deleter deleter, std::size_t bytes);
+
+  template <typename T>
+  void retire(T *ptr) {
+    retire(ptr, [](void *p) { delete static_cast<T *>(p); }, sizeof(T));
+  }
+
+ private:
+  Participant *owner_;
+};
+
+class Domain {
+ public:
+  static constexpr std::size_t kCollectInterval = 64;
+  static constexpr std::size_t kMaxPendingPerThread = 4096;
+
+  Domain() : epoch_(2), records_(nullptr), orphan_bytes_(0), orphan_count_(0) {}
+  Domain(const Domain &) = delete;
+  Domain &operator=(const Domain &) = delete;
+
+  // Every participant must be gone by now, so all garbage is unreachable.
+  ~Domain() {
+    for (detail::Record *record = records_.load(); record;) {
+      for (Bag &bag : record->bags) bag.free_all();
+      detail::Record *next = record->next;
+      delete record;
+      record = next;
+    }
+    for (Bag &bag : orphans_) bag.free_all();
+  }
+
+  // The process-wide domain used by concurrent containers. Never destroyed,
+  // so detached threads may keep retiring into it during shutdown.
+  static Domain &global() {
+    static Domain *domain = new Domain();
+    return *domain;
+  }
+
+  std::uint64_t epoch() const { return epoch_.load(std::memory_order_seq_cst); }
+
+  // Moves the epoch forward if every pinned participant has seen it.
+  bool try_advance() {
+    std::uint64_t current = epoch_.load(std::memory_order_seq_cst);
+    for (detail::Record *record = records_.load(std::memory_order_acquire);
+         record; record = record->next) {
+      std::uint64_t state = record->state.load(std::memory_order_seq_cst);
+      if ((state & detail::kPinned) && (state >> 1) != current) return false;
+    }
+    return epoch_.compare_exchange_strong(current, current + 1,
+                                          std::memory_order_seq_cst);
+  }
+
+  // ---------------- Instrumentation ---------------------
+
+  std::size_t pending_bytes() const {
+    std::size_t total = orphan_bytes_.load(std::memory_order_relaxed);
+    for (detail::Record *record = records_.load(std::memory_order_acquire);
+         record; record = record->next) {
+      total += record->pending_bytes.load(std::memory_order_relaxed);
+    }
+    return total;
+  }
+
+  std::size_t pending_count() const {
+    std::size_t total = orphan_count_.load(std::memory_order_relaxed);
+    for (detail::Record *record = records_.load(std::memory_order_acquire);
+         record; record = record->next) {
+      total += record->pending_count.load(std::memory_order_relaxed);
+    }
+    return total;
+  }
+
+  std::size_t participants() const {
+    std::size_t total = 0;
+    for (detail::Record *record = records_.load(std::memory_order_acquire);
+         record; record = record->next) {
+      total += record->in_use.load(std::memory_order_relaxed);
+    }
+    return total;
+  }
+
+ private:
+  friend class Participant;
+
+  detail::Record *acquire_record() {
+    for (detail::Record *record = records_.load(std::memory_order_acquire);
+         record; record = record->next) {
+      bool expected = false;
+      if (!record->in_use.load(std::memory_order_relaxed) &&
+          record->in_use.compare_exchange_strong(expected, true,
+                                                 std::memory_order_acquire)) {
+        return record;
+      }
+    }
+    detail::Record *record = new detail::Record();
+    record->in_use.store(true, std::memory_order_relaxed);
+    record->next = records_.load(std::memory_order_relaxed);
+    while (!records_.compare_exchange_weak(record->next, record,
+                                           std::memory_order_release,
+                                           std::memory_order_relaxed)) {
+    }
+    return record;
+  }
+
+  // Garbage a participant could not free on its own goes here and is freed
+  // by whichever participant collects next.
+  void adopt(Bag &bag) {
+    if (bag.items.empty()) return;
+    std::lock_guard<std::mutex> lock(orphans_mutex_);
+    orphan_bytes_.fetch_add(bag.bytes, std::memory_order_relaxed);
+    orphan_count_.fetch_add(bag.items.size(), std::memory_order_relaxed);
+    orphans_.push_back(std::move(bag));
+    bag = Bag();
+  }
+
+  void collect_orphans() {
+    std::unique_lock<std::mutex> lock(orphans_mutex_, std::try_to_lock);
+    if (!lock.owns_lock() || orphans_.empty()) return;
+    std::uint64_t current = epoch();
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i < orphans_.size(); ++i) {
+      Bag &bag = orphans_[i];
+      if (bag.epoch + 2 <= current) {
+        orphan_bytes_.fetch_sub(bag.bytes, std::memory_order_relaxed);
+        orphan_count_.fetch_sub(bag.items.size(), std::memory_order_relaxed);
+        bag.free_all();
+      } else {
+        if (kept != i) orphans_[kept] = std::move(bag);
+        ++kept;
+      }
+    }
+    while (orphans_.size() > kept) orphans_.pop_back();
+  }
+
+  std::atomic<std::uint64_t> epoch_;
+  std::atomic<detail::Record *> records_;
+  std::mutex orphans_mutex_;
+  s21::Vector<Bag> orphans_;
+  std::atomic<std::size_t> orphan_bytes_;
+  std::atomic<std::size_t> orphan_count_;
+};
+
+// A thread's registration with a domain. Owned by exactly one thread.
+class Participant {
+ public:
+  explicit Participant(Domain &domain = Domain::global())
+      : domain_(&domain), record_(domain.acquire_record()) {}
+  Participant(const Participant &) = delete;
+  Participant &operator=(const Participant &) = delete;
+
+  ~Participant() {
+    if (record_->nesting) {
+      record_->nesting = 1;
+      unpin();
+    }
+    collect();
+    for (Bag &bag : record_->bags) release_bag(bag);
+    record_->in_use.store(false, std::memory_order_release);
+  }
+
+  Guard pin() { return Guard(this); }
+  bool pinned() const { return record_->nesting != 0; }
+
+  void retire(void *ptr, Deleter deleter, std::size_t bytes) {
+    std::uint64_t current = domain_->epoch();
+    Bag &bag = record_->bags[current % 3];
+    if (bag.epoch != current) {
+      // Same slot three epochs ago, so everything in it is safe to free.
+      free_bag(bag);
+      bag.epoch = current;
+    }
+    bag.items.push_back(Retired{ptr, deleter, bytes});
+    bag.bytes += bytes;
+    add_pending(bytes, 1);
+    if (++record_->since_collect >= Domain::kCollectInterval) collect();
+    if (record_->pending_count.load(std::memory_order_relaxed) >
+        Domain::kMaxPendingPerThread) {
+      for (Bag &full : record_->bags) release_bag(full);
+    }
+  }
+
+  template <typename T>
+  void retire(T *ptr) {
+    retire(ptr, [](void *p) { delete static_cast<T *>(p); }, sizeof(T));
+  }
+
+  // Tries to advance the epoch and frees every bag that became safe.
+  void collect() {
+    record_->since_collect = 0;
+    domain_->try_advance();
+    std::uint64_t current = domain_->epoch();
+    for (Bag &bag : record_->bags) {
+      if (bag.epoch + 2 <= current) free_bag(bag);
+    }
+    domain_->collect_orphans();
+  }
+
+  Domain &domain() { return *domain_; }
+
+ private:
+  friend class Guard;
+
+  void pin_once() {
+    if (record_->nesting++ != 0) return;
+    std::uint64_t current = domain_->epoch();
+    for (;;) {
+      record_->state.exchange(current << 1 | detail::kPinned,
+                              std::memory_order_seq_cst);
+      std::uint64_t seen = domain_->epoch();
+      if (seen == current) break;
+      current = seen;
+    }
+  }
+
+  void unpin() {
+    if (--record_->nesting != 0) return;
+    record_->state.store(record_->state.load(std::memory_order_relaxed) &
+                             ~detail::kPinned,
+                         std::memory_order_release);
+  }
+
+  void add_pending(std::size_t bytes, std::size_t count) {
+    record_->pending_bytes.store(
+        record_->pending_bytes.load(std::memory_order_relaxed) + bytes,
+        std::memory_order_relaxed);
+    record_->pending_count.store(
+        record_->pending_count.load(std::memory_order_relaxed) + count,
+        std::memory_order_relaxed);
+  }
+
+  void sub_pending(const Bag &bag) {
+    record_->pending_bytes.store(
+        record_->pending_bytes.load(std::memory_order_relaxed) - bag.bytes,
+        std::memory_order_relaxed);
+    record_->pending_count.store(
+        record_->pending_count.load(std::memory_order_relaxed) -
+            bag.items.size(),
+        std::memory_order_relaxed);
+  }
+
+  void free_bag(Bag &bag) {
+    sub_pending(bag);
+    bag.free_all();
+  }
+
+  void release_bag(Bag &bag) {
+    sub_pending(bag);
+    domain_->adopt(bag);
+  }
+
+  Domain *domain_;
+  detail::Record *record_;
+};
+
+inline Guard::Guard(Participant *owner) : owner_(owner) { owner_->pin_once(); }
+
+inline Guard::~Guard() {
+  if (owner_) owner_->unpin();
+}
+
+inline void Guard::retire(void *ptr, Deleter deleter, std::size_t bytes) {
+  owner_->retire(ptr, deleter, bytes);
+}
+
+// ---------------- Global domain shortcuts ---------------------
+
+inline Participant &local() {
+  static thread_local Participant participant(Domain::global());
+  return participant;
+}
+
+inline Guard pin() { return local().pin(); }
+
+template <typename T>
+void retire(T *ptr) {
+  local().retire(ptr);
+}
+
+inline void retire(void *ptr, Deleter deleter, std::size_t bytes) {
+  local().retire(ptr, deleter, bytes);
+}
+}  // namespace epoch
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_EPOCH_H
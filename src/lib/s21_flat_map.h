@@ -0,0 +1,353 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_FLAT_MAP_H
+#define CPP2_S21_CONTAINERS_SRC_FLAT_MAP_H
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_flat_tree.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// Map kept as two parallel sorted s21::Vectors, one of keys and one of
+// values, so a lookup is a branchless binary search that touches only
+// keys. Single inserts and erases shift the tail; build it with the bulk
+// insert(first, last). Iterators walk both vectors together and yield a
+// pair of references, so there is no operator->.
+template <typename Key, typename T, typename Compare = std::less<Key>>
+class FlatMap {
+  template <bool Const>
+  class BasicIterator;
+
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using key_compare = Compare;
+  using iterator = BasicIterator<false>;
+  using const_iterator = BasicIterator<true>;
+  using size_type = std::size_t;
+
+  FlatMap() : keys_(), values_(), comp_() {}
+  explicit FlatMap(const Compare &comp) : keys_(), values_(), comp_(comp) {}
+
+  FlatMap(std::initializer_list<value_type> const &items)
+      : FlatMap(items.begin(), items.end()) {}
+
+  template <class InputIt>
+  FlatMap(InputIt first, InputIt last, const Compare &comp = Compare())
+      : keys_(), values_(), comp_(comp) {
+    insert(first, last);
+  }
+
+  FlatMap(const FlatMap &other)
+      : keys_(other.keys_), values_(other.values_), comp_(other.comp_) {}
+  FlatMap(FlatMap &&other) noexcept
+      : keys_(std::move(other.keys_)),
+        values_(std::move(other.values_)),
+        comp_(other.comp_) {}
+
+  FlatMap &operator=(const FlatMap &other) {
+    keys_ = other.keys_;
+    values_ = other.values_;
+    comp_ = other.comp_;
+    return *this;
+  }
+
+  FlatMap &operator=(FlatMap &&other) noexcept {
+    keys_ = std::move(other.keys_);
+    values_ = std::move(other.values_);
+    comp_ = other.comp_;
+    return *this;
+  }
+
+  ~FlatMap() {}
+
+  mapped_type &at(const key_type &key) { return values_[at_index(key)]; }
+  const mapped_type &at(const key_type &key) const {
+    return values_[at_index(key)];
+  }
+
+  mapped_type &operator[](const key_type &key) {
+    return (*try_emplace(key).first).second;
+  }
+
+  iterator begin() { return iterator(keys_.data(), values_.data()); }
+  iterator end() { return begin() + keys_.size(); }
+  const_iterator begin() const {
+    return const_iterator(keys_.data(), values_.data());
+  }
+  const_iterator end() const { return begin() + keys_.size(); }
+
+  bool empty() const { return keys_.empty(); }
+  size_type size() const { return keys_.size(); }
+  size_type max_size() const { return keys_.max_size(); }
+
+  // The sorted keys and their values, index for index.
+  const s21::Vector<key_type> &keys() const { return keys_; }
+  const s21::Vector<mapped_type> &values() const { return values_; }
+
+  void reserve(size_type count) {
+    keys_.reserve(count);
+    values_.reserve(count);
+  }
+
+  void clear() {
+    keys_.clear();
+    values_.clear();
+  }
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return try_emplace(value.first, value.second);
+  }
+
+  std::pair<iterator, bool> insert(const key_type &key,
+                                   const mapped_type &obj) {
+    return try_emplace(key, obj);
+  }
+
+  template <class M>
+  std::pair<iterator, bool> insert_or_assign(const key_type &key, M &&obj) {
+    size_type index = lower_index(key);
+    if (index < keys_.size() && !comp_(key, keys_[index])) {
+      values_[index] = std::forward<M>(obj);
+      return {begin() + index, false};
+    }
+    return {emplace_at(index, key, std::forward<M>(obj)), true};
+  }
+
+  template <class... Args>
+  std::pair<iterator, bool> try_emplace(const key_type &key,
+                                        Args &&...args) {
+    size_type index = lower_index(key);
+    if (index < keys_.size() && !comp_(key, keys_[index])) {
+      return {begin() + index, false};
+    }
+    return {emplace_at(index, key, std::forward<Args>(args)...), true};
+  }
+
+  // Sorts the batch and merges it with the map in one pass: O(n + m log m)
+  // instead of O(n) per element. Existing keys are kept and, within the
+  // batch, the first of equal keys wins.
+  template <class InputIt>
+  void insert(InputIt first, InputIt last) {
+    s21::Vector<std::pair<key_type, mapped_type>> batch;
+    for (; first != last; ++first) {
+      batch.push_back({(*first).first, (*first).second});
+    }
+    auto key_of = [](const std::pair<key_type, mapped_type> &item)
+        -> const key_type & { return item.first; };
+    size_type count = flat_detail::sort_unique(batch, key_of, comp_);
+    s21::Vector<key_type> keys;
+    s21::Vector<mapped_type> values;
+    keys.reserve(keys_.size() + count);
+    values.reserve(keys_.size() + count);
+    flat_detail::merge(
+        keys_, batch, count, key_of, comp_,
+        [&](size_type i) {
+          keys.push_back(std::move(keys_[i]));
+          values.push_back(std::move(values_[i]));
+        },
+        [&](size_type j) {
+          keys.push_back(std::move(batch[j].first));
+          values.push_back(std::move(batch[j].second));
+        });
+    keys_.swap(keys);
+    values_.swap(values);
+  }
+
+  template <class... Args>
+  void insert_many(Args &&...args) {
+    (insert(std::forward<Args>(args)), ...);
+  }
+
+  void erase(const_iterator pos) {
+    size_type index = pos - begin();
+    keys_.erase(keys_.data() + index);
+    values_.erase(values_.data() + index);
+  }
+
+  size_type erase(const key_type &key) {
+    const_iterator found = static_cast<const FlatMap &>(*this).find(key);
+    if (found == end()) return 0;
+    erase(found);
+    return 1;
+  }
+
+  void swap(FlatMap &other) {
+    keys_.swap(other.keys_);
+    values_.swap(other.values_);
+    std::swap(comp_, other.comp_);
+  }
+
+  // Moves over the elements whose keys are not here yet; the rest stay in
+  // other.
+  void merge(FlatMap &other) {
+    FlatMap rest(other.comp_);
+    for (const_iterator it = other.begin(); it != other.end(); ++it) {
+      if (contains(it.key())) {
+        rest.keys_.push_back(it.key());
+        rest.values_.push_back(it.value());
+      }
+    }
+    insert(other.begin(), other.end());
+    other.swap(rest);
+  }
+
+  iterator find(const key_type &key) { return begin() + find_index(key); }
+  const_iterator find(const key_type &key) const {
+    return begin() + find_index(key);
+  }
+
+  bool contains(const key_type &key) const {
+    return find_index(key) != keys_.size();
+  }
+
+  size_type count(const key_type &key) const { return contains(key); }
+
+  iterator lower_bound(const key_type &key) {
+    return begin() + lower_index(key);
+  }
+  const_iterator lower_bound(const key_type &key) const {
+    return begin() + lower_index(key);
+  }
+
+  iterator upper_bound(const key_type &key) {
+    return begin() + upper_index(key);
+  }
+  const_iterator upper_bound(const key_type &key) const {
+    return begin() + upper_index(key);
+  }
+
+  std::pair<iterator, iterator> equal_range(const key_type &key) {
+    return {lower_bound(key), upper_bound(key)};
+  }
+  std::pair<const_iterator, const_iterator> equal_range(
+      const key_type &key) const {
+    return {lower_bound(key), upper_bound(key)};
+  }
+
+  key_compare key_comp() const { return comp_; }
+
+ private:
+  template <bool Const>
+  class BasicIterator {
+    using mapped_pointer =
+        std::conditional_t<Const, const mapped_type *, mapped_type *>;
+    using mapped_reference =
+        std::conditional_t<Const, const mapped_type &, mapped_type &>;
+
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = std::pair<const key_type, mapped_type>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = std::pair<const key_type &, mapped_reference>;
+
+    BasicIterator() : key_(nullptr), value_(nullptr) {}
+    BasicIterator(const key_type *key, mapped_pointer value)
+        : key_(key), value_(value) {}
+
+    template <bool C = Const, class = std::enable_if_t<C>>
+    BasicIterator(const BasicIterator<false> &other)
+        : key_(other.key_), value_(other.value_) {}
+
+    reference operator*() const { return {*key_, *value_}; }
+    const key_type &key() const { return *key_; }
+    mapped_reference value() const { return *value_; }
+
+    BasicIterator &operator++() {
+      ++key_;
+      ++value_;
+      return *this;
+    }
+
+    BasicIterator operator++(int) {
+      BasicIterator old = *this;
+      ++*this;
+      return old;
+    }
+
+    BasicIterator &operator--() {
+      --key_;
+      --value_;
+      return *this;
+    }
+
+    BasicIterator operator--(int) {
+      BasicIterator old = *this;
+      --*this;
+      return old;
+    }
+
+    BasicIterator operator+(size_type n) const {
+      return BasicIterator(key_ + n, value_ + n);
+    }
+
+    std::ptrdiff_t operator-(const BasicIterator &other) const {
+      return key_ - other.key_;
+    }
+
+    bool operator==(const BasicIterator &other) const {
+      return key_ == other.key_;
+    }
+    bool operator!=(const BasicIterator &other) const {
+      return key_ != other.key_;
+    }
+
+   private:
+    friend class BasicIterator<true>;
+
+    const key_type *key_;
+    mapped_pointer value_;
+  };
+
+  // Inserts key before index with a value built from args. The value is
+  // built and inserted first, so a throw leaves no key without a value.
+  template <class... Args>
+  iterator emplace_at(size_type index, const key_type &key, Args &&...args) {
+    mapped_type value(std::forward<Args>(args)...);
+    values_.insert(values_.data() + index, value);
+    try {
+      keys_.insert(keys_.data() + index, key);
+    } catch (...) {
+      values_.erase(values_.data() + index);
+      throw;
+    }
+    return begin() + index;
+  }
+
+  size_type lower_index(const key_type &key) const {
+    return flat_detail::lower_bound(keys_.data(), keys_.size(), key, comp_);
+  }
+
+  size_type upper_index(const key_type &key) const {
+    return flat_detail::upper_bound(keys_.data(), keys_.size(), key, comp_);
+  }
+
+  // Index of key, or size() if it is absent.
+  size_type find_index(const key_type &key) const {
+    size_type index = lower_index(key);
+    if (index == keys_.size() || comp_(key, keys_[index])) {
+      return keys_.size();
+    }
+    return index;
+  }
+
+  size_type at_index(const key_type &key) const {
+    size_type index = find_index(key);
+    if (index == keys_.size()) throw std::out_of_range("Key does not exist!");
+    return index;
+  }
+
+  s21::Vector<key_type> keys_;
+  s21::Vector<mapped_type> values_;
+  Compare comp_;
+};
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_FLAT_MAP_H
@@ -0,0 +1,164 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_FLAT_SET_H
+#define CPP2_S21_CONTAINERS_SRC_FLAT_SET_H
+
+#include <functional>
+#include <initializer_list>
+#include <utility>
+
+#include "s21_flat_tree.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// Set kept as one sorted s21::Vector: lookups are a branchless binary
+// search over contiguous keys, iteration is a pointer walk. Single inserts
+// and erases shift the tail, so it suits data built once and read often;
+// build it with the bulk insert(first, last). Elements are immutable, so
+// iterator is a const_iterator.
+template <typename Key, typename Compare = std::less<Key>>
+class FlatSet {
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using key_compare = Compare;
+  using reference = const value_type &;
+  using const_reference = const value_type &;
+  using iterator = const value_type *;
+  using const_iterator = iterator;
+  using size_type = std::size_t;
+
+  FlatSet() : keys_(), comp_() {}
+  explicit FlatSet(const Compare &comp) : keys_(), comp_(comp) {}
+
+  FlatSet(std::initializer_list<value_type> const &items)
+      : FlatSet(items.begin(), items.end()) {}
+
+  template <class InputIt>
+  FlatSet(InputIt first, InputIt last, const Compare &comp = Compare())
+      : keys_(), comp_(comp) {
+    insert(first, last);
+  }
+
+  FlatSet(const FlatSet &other) : keys_(other.keys_), comp_(other.comp_) {}
+  FlatSet(FlatSet &&other) noexcept
+      : keys_(std::move(other.keys_)), comp_(other.comp_) {}
+
+  FlatSet &operator=(const FlatSet &other) {
+    keys_ = other.keys_;
+    comp_ = other.comp_;
+    return *this;
+  }
+
+  FlatSet &operator=(FlatSet &&other) noexcept {
+    keys_ = std::move(other.keys_);
+    comp_ = other.comp_;
+    return *this;
+  }
+
+  ~FlatSet() {}
+
+  iterator begin() const { return keys_.data(); }
+  iterator end() const { return keys_.data() + keys_.size(); }
+
+  bool empty() const { return keys_.empty(); }
+  size_type size() const { return keys_.size(); }
+  size_type max_size() const { return keys_.max_size(); }
+
+  void reserve(size_type count) { keys_.reserve(count); }
+  void clear() { keys_.clear(); }
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    size_type index = lower_index(value);
+    if (index < keys_.size() && !comp_(value, keys_[index])) {
+      return {begin() + index, false};
+    }
+    keys_.insert(keys_.data() + index, value);
+    return {begin() + index, true};
+  }
+
+  // Sorts the batch and merges it with the keys in one pass: O(n + m log m)
+  // instead of O(n) per element. Existing keys are kept and, within the
+  // batch, the first of equal keys wins.
+  template <class InputIt>
+  void insert(InputIt first, InputIt last) {
+    s21::Vector<value_type> batch;
+    for (; first != last; ++first) batch.push_back(*first);
+    size_type count = flat_detail::sort_unique(batch, Identity(), comp_);
+    s21::Vector<value_type> merged;
+    merged.reserve(keys_.size() + count);
+    flat_detail::merge(
+        keys_, batch, count, Identity(), comp_,
+        [&](size_type i) { merged.push_back(std::move(keys_[i])); },
+        [&](size_type j) { merged.push_back(std::move(batch[j])); });
+    keys_.swap(merged);
+  }
+
+  template <class... Args>
+  void insert_many(Args &&...args) {
+    (insert(std::forward<Args>(args)), ...);
+  }
+
+  void erase(iterator pos) { keys_.erase(pos); }
+
+  size_type erase(const key_type &key) {
+    iterator found = find(key);
+    if (found == end()) return 0;
+    erase(found);
+    return 1;
+  }
+
+  void swap(FlatSet &other) {
+    keys_.swap(other.keys_);
+    std::swap(comp_, other.comp_);
+  }
+
+  // Moves over the keys not here yet; the rest stay in other.
+  void merge(FlatSet &other) {
+    s21::Vector<value_type> rest;
+    for (const value_type &key : other.keys_) {
+      if (contains(key)) rest.push_back(key);
+    }
+    insert(other.begin(), other.end());
+    other.keys_.swap(rest);
+  }
+
+  iterator find(const key_type &key) const {
+    size_type index = lower_index(key);
+    if (index == keys_.size() || comp_(key, keys_[index])) return end();
+    return begin() + index;
+  }
+
+  bool contains(const key_type &key) const { return find(key) != end(); }
+  size_type count(const key_type &key) const { return contains(key); }
+
+  iterator lower_bound(const key_type &key) const {
+    return begin() + lower_index(key);
+  }
+
+  iterator upper_bound(const key_type &key) const {
+    return begin() +
+           flat_detail::upper_bound(begin(), keys_.size(), key, comp_);
+  }
+
+  std::pair<iterator, iterator> equal_range(const key_type &key) const {
+    return {lower_bound(key), upper_bound(key)};
+  }
+
+  key_compare key_comp() const { return comp_; }
+
+ private:
+  struct Identity {
+    const value_type &operator()(const value_type &value) const {
+      return value;
+    }
+  };
+
+  size_type lower_index(const key_type &key) const {
+    return flat_detail::lower_bound(begin(), keys_.size(), key, comp_);
+  }
+
+  s21::Vector<value_type> keys_;
+  Compare comp_;
+};
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_FLAT_SET_H
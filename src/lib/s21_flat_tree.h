@@ -0,0 +1,92 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_FLAT_TREE_H
+#define CPP2_S21_CONTAINERS_SRC_FLAT_TREE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+
+#include "s21_vector.h"
+
+namespace s21 {
+// Helpers shared by FlatMap and FlatSet, which keep their keys in one
+// sorted s21::Vector.
+namespace flat_detail {
+// Index of the first of keys[0, n) not less than key. Each step halves the
+// range by adding half times the comparison instead of branching on it, so
+// the loop runs the same log2(n) steps whatever the key and never
+// mispredicts. Both possible next midpoints are prefetched, which overlaps
+// the cache misses of large arrays.
+template <typename Key, typename Probe, typename Compare>
+std::size_t lower_bound(const Key *keys, std::size_t n, const Probe &key,
+                        Compare comp) {
+  if (n == 0) return 0;
+  const Key *base = keys;
+  while (n > 1) {
+    std::size_t half = n / 2;
+    __builtin_prefetch(base + half / 2);
+    __builtin_prefetch(base + half + half / 2);
+    base += half * comp(base[half - 1], key);
+    n -= half;
+  }
+  return static_cast<std::size_t>(base - keys) + comp(*base, key);
+}
+
+// Index of the first of keys[0, n) greater than key.
+template <typename Key, typename Probe, typename Compare>
+std::size_t upper_bound(const Key *keys, std::size_t n, const Probe &key,
+                        Compare comp) {
+  if (n == 0) return 0;
+  const Key *base = keys;
+  while (n > 1) {
+    std::size_t half = n / 2;
+    __builtin_prefetch(base + half / 2);
+    __builtin_prefetch(base + half + half / 2);
+    base += half * !comp(key, base[half - 1]);
+    n -= half;
+  }
+  return static_cast<std::size_t>(base - keys) + !comp(key, *base);
+}
+
+// Sorts batch by key and moves the first of each run of equal keys to the
+// front, as repeated insert would keep them. Returns how many are kept.
+template <typename Item, typename KeyOf, typename Compare>
+std::size_t sort_unique(s21::Vector<Item> &batch, KeyOf key_of,
+                        Compare comp) {
+  std::stable_sort(batch.begin(), batch.end(),
+                   [&](const Item &a, const Item &b) {
+                     return comp(key_of(a), key_of(b));
+                   });
+  std::size_t kept = 0;
+  for (std::size_t i = 0; i < batch.size(); ++i) {
+    if (kept && !comp(key_of(batch[kept - 1]), key_of(batch[i]))) continue;
+    if (kept != i) batch[kept] = std::move(batch[i]);
+    ++kept;
+  }
+  return kept;
+}
+
+// One pass over sorted keys and the sorted, unique batch[0, count), calling
+// take_old(i) or take_new(j) in key order. Of equal keys only the old one
+// is taken.
+template <typename Key, typename Item, typename KeyOf, typename Compare,
+          typename TakeOld, typename TakeNew>
+void merge(const s21::Vector<Key> &keys, const s21::Vector<Item> &batch,
+           std::size_t count, KeyOf key_of, const Compare &comp,
+           TakeOld take_old, TakeNew take_new) {
+  std::size_t i = 0;
+  std::size_t j = 0;
+  while (i < keys.size() && j < count) {
+    if (comp(key_of(batch[j]), keys[i])) {
+      take_new(j++);
+    } else {
+      if (!comp(keys[i], key_of(batch[j]))) ++j;
+      take_old(i++);
+    }
+  }
+  while (i < keys.size()) take_old(i++);
+  while (j < count) take_new(j++);
+}
+}  // namespace flat_detail
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_FLAT_TREE_H
@@ -0,0 +1,21 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_HASH_MIX_H
+#define CPP2_S21_CONTAINERS_SRC_HASH_MIX_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace s21 {
+namespace hash_detail {
+// Folds a 128-bit product so identity hashes of small integers still
+// spread over all 64 bits: the hash tables take bucket or group indices
+// and control bytes from different parts of the result.
+inline std::uint64_t mix(std::size_t hash) {
+  unsigned __int128 product =
+      static_cast<unsigned __int128>(hash) * 0x9E3779B97F4A7C15ull;
+  return static_cast<std::uint64_t>(product) ^
+         static_cast<std::uint64_t>(product >> 64);
+}
+}  // namespace hash_detail
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_HASH_MIX_H
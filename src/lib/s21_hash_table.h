@@ -0,0 +1,493 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_HASH_TABLE_H
+#define CPP2_S21_CONTAINERS_SRC_HASH_TABLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "s21_hash_mix.h"
+
+namespace s21 {
+namespace hash_detail {
+using ctrl_t = std::int8_t;
+
+// A control byte per slot: the low 7 bits of the hash for a full slot,
+// otherwise one of the negative markers below.
+constexpr ctrl_t kEmpty = -128;
+constexpr ctrl_t kDeleted = -2;
+constexpr std::size_t kGroupWidth = 16;
+
+// Positions of set bits in a group match, lowest first.
+class BitMask {
+ public:
+  explicit BitMask(std::uint32_t mask) : mask_(mask) {}
+
+  explicit operator bool() const { return mask_ != 0; }
+  std::size_t lowest() const { return __builtin_ctz(mask_); }
+  void clear_lowest() { mask_ &= mask_ - 1; }
+
+ private:
+  std::uint32_t mask_;
+};
+
+// Sixteen control bytes probed at once: one SSE2 compare and movemask per
+// query, or a byte loop where SSE2 is not available.
+class Group {
+ public:
+#if defined(__SSE2__)
+  explicit Group(const ctrl_t *pos)
+      : ctrl_(_mm_loadu_si128(reinterpret_cast<const __m128i *>(pos))) {}
+
+  BitMask match(ctrl_t h2) const {
+    return mask_of(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl_));
+  }
+
+  BitMask match_empty() const {
+    return mask_of(_mm_cmpeq_epi8(_mm_set1_epi8(kEmpty), ctrl_));
+  }
+
+  // Empty and deleted slots are exactly the negative control bytes.
+  BitMask match_free() const {
+    return mask_of(_mm_cmpgt_epi8(_mm_setzero_si128(), ctrl_));
+  }
+
+ private:
+  static BitMask mask_of(__m128i bytes) {
+    return BitMask(static_cast<std::uint32_t>(_mm_movemask_epi8(bytes)));
+  }
+
+  __m128i ctrl_;
+#else
+  explicit Group(const ctrl_t *pos) { std::memcpy(ctrl_, pos, kGroupWidth); }
+
+  BitMask match(ctrl_t h2) const {
+    return mask_if([h2](ctrl_t c) { return c == h2; });
+  }
+
+  BitMask match_empty() const {
+    return mask_if([](ctrl_t c) { return c == kEmpty; });
+  }
+
+  BitMask match_free() const {
+    return mask_if([](ctrl_t c) { return c < 0; });
+  }
+
+ private:
+  template <typename Pred>
+  BitMask mask_if(Pred pred) const {
+    std::uint32_t mask = 0;
+    for (std::size_t i = 0; i < kGroupWidth; ++i) {
+      if (pred(ctrl_[i])) mask |= std::uint32_t{1} << i;
+    }
+    return BitMask(mask);
+  }
+
+  ctrl_t ctrl_[kGroupWidth];
+#endif
+};
+}  // namespace hash_detail
+
+// Open-addressing table in the Swiss-table layout: slots come in groups of
+// sixteen, each with a byte of control data, and a probe checks a whole
+// group's control bytes with one vector compare before touching a slot.
+// Groups are visited by triangular probing, so every group is reached.
+// Erasing leaves a tombstone only when the slot's group is full of other
+// slots, since only then may a probe have passed over it.
+template <typename Value, typename KeyOf, typename Hash, typename KeyEqual>
+class HashTable : private Hash, private KeyEqual {
+  using ctrl_t = hash_detail::ctrl_t;
+  using Group = hash_detail::Group;
+  using BitMask = hash_detail::BitMask;
+
+ public:
+  using value_type = Value;
+  using size_type = std::size_t;
+
+  template <bool Const>
+  class BasicIterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Value;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<Const, const Value *, Value *>;
+    using reference = std::conditional_t<Const, const Value &, Value &>;
+
+    BasicIterator() : ctrl_(nullptr), slot_(nullptr), end_(nullptr) {}
+
+    template <bool C = Const, typename = std::enable_if_t<C>>
+    BasicIterator(const BasicIterator<false> &other)
+        : ctrl_(other.ctrl_), slot_(other.slot_), end_(other.end_) {}
+
+    reference operator*() const { return *slot_; }
+    pointer operator->() const { return slot_; }
+
+    BasicIterator &operator++() {
+      ++ctrl_;
+      ++slot_;
+      skip_free();
+      return *this;
+    }
+
+    BasicIterator operator++(int) {
+      BasicIterator copy = *this;
+      ++*this;
+      return copy;
+    }
+
+    bool operator==(const BasicIterator &other) const {
+      return ctrl_ == other.ctrl_;
+    }
+    bool operator!=(const BasicIterator &other) const {
+      return ctrl_ != other.ctrl_;
+    }
+
+   private:
+    friend class HashTable;
+    friend class BasicIterator<true>;
+
+    BasicIterator(const ctrl_t *ctrl, Value *slot, const ctrl_t *end)
+        : ctrl_(ctrl), slot_(slot), end_(end) {}
+
+    void skip_free() {
+      while (ctrl_ != end_ && *ctrl_ < 0) {
+        ++ctrl_;
+        ++slot_;
+      }
+    }
+
+    const ctrl_t *ctrl_;
+    Value *slot_;
+    const ctrl_t *end_;
+  };
+
+  using iterator = BasicIterator<false>;
+  using const_iterator = BasicIterator<true>;
+
+  // Keeps at most 7 of every 8 slots in use.
+  static size_type max_load(size_type capacity) {
+    return capacity - capacity / 8;
+  }
+
+  explicit HashTable(const Hash &hash = Hash(),
+                     const KeyEqual &equal = KeyEqual())
+      : Hash(hash),
+        KeyEqual(equal),
+        ctrl_(nullptr),
+        slots_(nullptr),
+        capacity_(0),
+        size_(0),
+        growth_left_(0) {}
+
+  HashTable(const HashTable &other)
+      : HashTable(other.hash_function(), other.key_eq()) {
+    if (other.size_) reserve(other.size_);
+    for (const Value &value : other) insert_unique(value);
+  }
+
+  HashTable(HashTable &&other) noexcept
+      : Hash(std::move(other)),
+        KeyEqual(std::move(other)),
+        ctrl_(other.ctrl_),
+        slots_(other.slots_),
+        capacity_(other.capacity_),
+        size_(other.size_),
+        growth_left_(other.growth_left_) {
+    other.release();
+  }
+
+  HashTable &operator=(const HashTable &other) {
+    if (this != &other) {
+      HashTable copy(other);
+      swap(copy);
+    }
+    return *this;
+  }
+
+  HashTable &operator=(HashTable &&other) noexcept {
+    swap(other);
+    return *this;
+  }
+
+  ~HashTable() {
+    destroy_all();
+    deallocate();
+  }
+
+  iterator begin() {
+    iterator it(ctrl_, slots_, ctrl_ + capacity_);
+    it.skip_free();
+    return it;
+  }
+
+  iterator end() { return iterator(ctrl_ + capacity_, nullptr, nullptr); }
+
+  const_iterator begin() const {
+    return const_cast<HashTable *>(this)->begin();
+  }
+
+  const_iterator end() const { return const_cast<HashTable *>(this)->end(); }
+
+  bool empty() const { return size_ == 0; }
+  size_type size() const { return size_; }
+  size_type capacity() const { return capacity_; }
+
+  size_type max_size() const {
+    return std::numeric_limits<size_type>::max() / (sizeof(Value) + 1);
+  }
+
+  float load_factor() const {
+    return capacity_ ? static_cast<float>(size_) / capacity_ : 0.0f;
+  }
+
+  const Hash &hash_function() const { return *this; }
+  const KeyEqual &key_eq() const { return *this; }
+
+  void clear() {
+    destroy_all();
+    if (capacity_) reset_ctrl();
+  }
+
+  // Makes room for count elements without a rehash.
+  void reserve(size_type count) {
+    size_type capacity = hash_detail::kGroupWidth;
+    while (max_load(capacity) < count) capacity <<= 1;
+    if (capacity > capacity_) resize(capacity);
+  }
+
+  template <typename K>
+  iterator find(const K &key) {
+    if (!capacity_) return end();
+    size_type index = find_index(key, hash_of(key));
+    return index == capacity_ ? end() : iterator_at(index);
+  }
+
+  template <typename K>
+  const_iterator find(const K &key) const {
+    return const_cast<HashTable *>(this)->find(key);
+  }
+
+  // Looks key up and, if it is missing, constructs a value from args in
+  // the first free slot of its probe sequence. A tombstone is reused
+  // without growing; when the table must grow, the value is built first,
+  // as args may refer to elements the rehash moves.
+  template <typename K, typename... Args>
+  std::pair<iterator, bool> try_emplace(const K &key, Args &&...args) {
+    std::uint64_t hash = hash_of(key);
+    size_type index = capacity_;
+    if (capacity_) {
+      size_type found = find_index(key, hash);
+      if (found != capacity_) return {iterator_at(found), false};
+      index = free_slot(hash);
+    }
+    if (index == capacity_ ||
+        (!growth_left_ && ctrl_[index] == hash_detail::kEmpty)) {
+      Value value(std::forward<Args>(args)...);
+      grow();
+      index = free_slot(hash);
+      new (slots_ + index) Value(std::move(value));
+    } else {
+      new (slots_ + index) Value(std::forward<Args>(args)...);
+    }
+    occupy(index, hash);
+    return {iterator_at(index), true};
+  }
+
+  // Constructs the value first; the key is taken from it.
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args &&...args) {
+    Value value(std::forward<Args>(args)...);
+    return try_emplace(KeyOf()(value), std::move(value));
+  }
+
+  void erase(const_iterator pos) {
+    size_type index = pos.ctrl_ - ctrl_;
+    slots_[index].~Value();
+    --size_;
+    size_type group_start = index & ~(hash_detail::kGroupWidth - 1);
+    if (Group(ctrl_ + group_start).match_empty()) {
+      ctrl_[index] = hash_detail::kEmpty;
+      ++growth_left_;
+    } else {
+      ctrl_[index] = hash_detail::kDeleted;
+    }
+  }
+
+  template <typename K>
+  size_type erase_key(const K &key) {
+    iterator it = find(key);
+    if (it == end()) return 0;
+    erase(it);
+    return 1;
+  }
+
+  void swap(HashTable &other) noexcept {
+    std::swap(static_cast<Hash &>(*this), static_cast<Hash &>(other));
+    std::swap(static_cast<KeyEqual &>(*this), static_cast<KeyEqual &>(other));
+    std::swap(ctrl_, other.ctrl_);
+    std::swap(slots_, other.slots_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(size_, other.size_);
+    std::swap(growth_left_, other.growth_left_);
+  }
+
+ private:
+  // Triangular probing over groups: offsets g, g+1, g+3, g+6, ... cover
+  // every group when their count is a power of two.
+  class Probe {
+   public:
+    Probe(std::uint64_t hash, size_type mask)
+        : group_((hash >> 7) & mask), mask_(mask), step_(0) {}
+
+    size_type offset() const { return group_ * hash_detail::kGroupWidth; }
+
+    void next() {
+      ++step_;
+      group_ = (group_ + step_) & mask_;
+    }
+
+   private:
+    size_type group_;
+    size_type mask_;
+    size_type step_;
+  };
+
+  template <typename K>
+  std::uint64_t hash_of(const K &key) const {
+    return hash_detail::mix(hash_function()(key));
+  }
+
+  static ctrl_t h2(std::uint64_t hash) {
+    return static_cast<ctrl_t>(hash & 0x7F);
+  }
+
+  size_type group_mask() const {
+    return capacity_ / hash_detail::kGroupWidth - 1;
+  }
+
+  iterator iterator_at(size_type index) {
+    return iterator(ctrl_ + index, slots_ + index, ctrl_ + capacity_);
+  }
+
+  // Slot holding key, or capacity_ once a group with an empty slot ends
+  // the probe.
+  template <typename K>
+  size_type find_index(const K &key, std::uint64_t hash) const {
+    Probe probe(hash, group_mask());
+    for (;;) {
+      Group group(ctrl_ + probe.offset());
+      for (BitMask match = group.match(h2(hash)); match; match.clear_lowest()) {
+        size_type index = probe.offset() + match.lowest();
+        if (key_eq()(KeyOf()(slots_[index]), key)) return index;
+      }
+      if (group.match_empty()) return capacity_;
+      probe.next();
+    }
+  }
+
+  size_type free_slot(std::uint64_t hash) const {
+    Probe probe(hash, group_mask());
+    for (;;) {
+      BitMask free = Group(ctrl_ + probe.offset()).match_free();
+      if (free) return probe.offset() + free.lowest();
+      probe.next();
+    }
+  }
+
+  void occupy(size_type index, std::uint64_t hash) {
+    if (ctrl_[index] == hash_detail::kEmpty) --growth_left_;
+    ctrl_[index] = h2(hash);
+    ++size_;
+  }
+
+  // Doubles the table, or only drops tombstones when they are what fills
+  // it.
+  void grow() {
+    if (capacity_ && size_ <= max_load(capacity_) / 2) {
+      resize(capacity_);
+    } else {
+      resize(capacity_ ? capacity_ * 2 : hash_detail::kGroupWidth);
+    }
+  }
+
+  void resize(size_type capacity) {
+    ctrl_t *old_ctrl = ctrl_;
+    Value *old_slots = slots_;
+    size_type old_capacity = capacity_;
+    ctrl_ = new ctrl_t[capacity];
+    try {
+      slots_ = std::allocator<Value>().allocate(capacity);
+    } catch (...) {
+      delete[] ctrl_;
+      ctrl_ = old_ctrl;
+      throw;
+    }
+    capacity_ = capacity;
+    reset_ctrl();
+    for (size_type i = 0; i < old_capacity; ++i) {
+      if (old_ctrl[i] < 0) continue;
+      std::uint64_t hash = hash_of(KeyOf()(old_slots[i]));
+      size_type index = free_slot(hash);
+      new (slots_ + index) Value(std::move_if_noexcept(old_slots[i]));
+      old_slots[i].~Value();
+      occupy(index, hash);
+    }
+    if (old_capacity) {
+      std::allocator<Value>().deallocate(old_slots, old_capacity);
+      delete[] old_ctrl;
+    }
+  }
+
+  void reset_ctrl() {
+    std::memset(ctrl_, static_cast<unsigned char>(hash_detail::kEmpty),
+                capacity_);
+    size_ = 0;
+    growth_left_ = max_load(capacity_);
+  }
+
+  void insert_unique(const Value &value) {
+    std::uint64_t hash = hash_of(KeyOf()(value));
+    size_type index = free_slot(hash);
+    new (slots_ + index) Value(value);
+    occupy(index, hash);
+  }
+
+  void destroy_all() {
+    for (size_type i = 0; i < capacity_; ++i) {
+      if (ctrl_[i] >= 0) slots_[i].~Value();
+    }
+  }
+
+  void deallocate() {
+    if (!capacity_) return;
+    std::allocator<Value>().deallocate(slots_, capacity_);
+    delete[] ctrl_;
+  }
+
+  void release() {
+    ctrl_ = nullptr;
+    slots_ = nullptr;
+    capacity_ = 0;
+    size_ = 0;
+    growth_left_ = 0;
+  }
+
+  ctrl_t *ctrl_;
+  Value *slots_;
+  size_type capacity_;
+  size_type size_;
+  // Empty slots that may still be filled before the table must grow.
+  size_type growth_left_;
+};
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_HASH_TABLE_H
@@ -2,6 +2,7 @@
 #define CPP2_S21_CONTAINERS_SRC_LIST_H
 
 #include <limits>
+#include <utility>
 
 namespace s21 {
 template <typename T>
@@ -20,7 +21,10 @@ class List {
  private:
   struct Node {
     Node() : value(value_type{}), next(nullptr), prev(nullptr){};
-    explicit Node(value_type val) : Node() { value = val; };
+    explicit Node(const_reference val)
+        : value(val), next(nullptr), prev(nullptr){};
+    explicit Node(value_type &&val)
+        : value(std::move(val)), next(nullptr), prev(nullptr){};
     ~Node(){};
 
     T value;
@@ -196,14 +200,14 @@ class List {
 
   const_iterator end() const { return const_iterator(); }
 
-  const_reference front() {
+  reference front() {
     if (head_ == nullptr) {
       throw std::out_of_range("Head does not exist");
     }
     return head_->value;
   }
 
-  const_reference back() {
+  reference back() {
     if (tail_ == nullptr) {
       throw std::out_of_range("Tail does not exist");
     }
@@ -268,17 +272,10 @@ class List {
     --size_;
   }
 
-  void push_back(const_reference value) {
-    Node *newNode = new Node(value);
-    if (!head_) {
-      head_ = tail_ = newNode;
-    } else {
-      tail_->next = newNode;
-      newNode->prev = tail_;
-      newNode->next = nullptr;
-      tail_ = newNode;
-    }
-    ++size_;
+  void push_back(const_reference value) { link_back(new Node(value)); }
+
+  void push_back(value_type &&value) {
+    link_back(new Node(std::move(value)));
   }
 
   void pop_back() {
@@ -468,6 +465,18 @@ class List {
 
   size_type size_;
 
+  void link_back(Node *newNode) {
+    if (!head_) {
+      head_ = tail_ = newNode;
+    } else {
+      tail_->next = newNode;
+      newNode->prev = tail_;
+      newNode->next = nullptr;
+      tail_ = newNode;
+    }
+    ++size_;
+  }
+
   void quickSort(Node *low, Node *high) {
     if (low != nullptr && high != nullptr && low != high && low != high->next) {
       Node *pivot = partition(low, high);
@@ -1,26 +1,42 @@
 #ifndef CPP2_S21_CONTAINERS_SRC_MAP_H
 #define CPP2_S21_CONTAINERS_SRC_MAP_H
 
+#include <functional>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
 #include "s21_avl_tree.h"
 
 namespace s21 {
-template <typename T, typename V>
+template <typename T, typename V, typename Compare = std::less<T>>
 class Map {
  public:
   using key_type = T;
   using mapped_type = V;
   using default_value = mapped_type &;
   using value_type = std::pair<const key_type, mapped_type>;
+  using key_compare = Compare;
   using node_type = node<value_type, mapped_type>;
-  using iterator = typename AVL<value_type, mapped_type>::Iterator;
-  using const_iterator = typename AVL<value_type, mapped_type>::ConstIterator;
+  using tree_type = AVL<value_type, mapped_type, Compare>;
+  using iterator = typename tree_type::Iterator;
+  using const_iterator = typename tree_type::ConstIterator;
+  using node_handle = TreeNodeHandle<node_type, true>;
+  using insert_return_type = TreeInsertReturn<iterator, node_handle>;
   using size_type = size_t;
 
   Map() : tree_() {}
+  explicit Map(const Compare &comp) : tree_(comp) {}
   Map(std::initializer_list<value_type> const &items) {
-    for (auto it : items) {
-      tree_.insert(it);
-    }
+    insert_sorted(items.begin(), items.end());
+  }
+
+  // O(n) from sorted input; anything else is sorted first. Of equal keys the
+  // first one wins, as with repeated insert.
+  template <class InputIt>
+  Map(InputIt first, InputIt last, const Compare &comp = Compare())
+      : tree_(comp) {
+    insert_sorted(first, last);
   }
 
   Map(const Map &m) : tree_(m.tree_) {}
@@ -38,23 +54,21 @@ class Map {
 
   ~Map() {}
 
-  mapped_type &at(const key_type &key) {
-    node_type *res = tree_.search(value_type{key, mapped_type{}});
-    if (res) {
-      return res->key_.second;
-    } else {
-      throw std::out_of_range("Key does not exist!");
-    }
+  mapped_type &at(const key_type &key) { return at_node(tree_.find_key(key)); }
+
+  // The heterogeneous overloads below take part only when Compare declares
+  // is_transparent, so e.g. a std::string_view probe needs no std::string.
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  mapped_type &at(const K &key) {
+    return at_node(tree_.find_key(key));
   }
 
   mapped_type &operator[](const key_type &key) {
-    node_type *res = tree_.search(value_type{key, mapped_type{}});
-    if (res) {
-      return res->key_.second;
-    } else {
-      auto returned = tree_.insert(value_type{key, mapped_type{}});
-      return returned->key_.second;
-    }
+    return try_emplace(key).first.iterated_node_->key_.second;
+  }
+
+  mapped_type &operator[](key_type &&key) {
+    return try_emplace(std::move(key)).first.iterated_node_->key_.second;
   }
 
   iterator begin() { return iterator(tree_.begin()); }
@@ -67,64 +81,239 @@ class Map {
   void clear() { tree_.clear(); }
 
   std::pair<iterator, bool> insert(const value_type &value) {
-    bool inserted{};
-    node_type *tmp = tree_.search(value_type{value.first, mapped_type{}});
-    if (!tmp) {
-      inserted = true;
-      tmp = tree_.insert(value);
+    return wrap(tree_.try_emplace(value.first, value));
+  }
+
+  std::pair<iterator, bool> insert(value_type &&value) {
+    return wrap(tree_.try_emplace(value.first, std::move(value)));
+  }
+
+  std::pair<iterator, bool> insert(const key_type &key,
+                                   const mapped_type &obj) {
+    return try_emplace(key, obj);
+  }
+
+  // Relinks an extracted node. If the key is taken, the handle comes back in
+  // the result still owning its node.
+  insert_return_type insert(node_handle &&handle) {
+    if (handle.empty()) return {end(), false, node_handle()};
+    auto result = tree_.insert_node(handle.get());
+    if (!result.second) {
+      return {iterator(result.first), false, std::move(handle)};
     }
-    iterator it(tmp);
-    return std::pair<iterator, bool>{it, inserted};
+    handle.release();
+    return {iterator(result.first), true, node_handle()};
   }
 
-  std::pair<iterator, bool> insert(const key_type &key, const T &obj) {
-    bool inserted{};
-    node_type *tmp = tree_.search(value_type{key, mapped_type{}});
-    if (!tmp) {
-      inserted = true;
-      tmp = tree_.insert(value_type{key, obj});
+  template <class M>
+  std::pair<iterator, bool> insert_or_assign(const key_type &key, M &&obj) {
+    auto result = try_emplace(key, std::forward<M>(obj));
+    if (!result.second) {
+      result.first.iterated_node_->key_.second = std::forward<M>(obj);
     }
-    iterator it(tmp);
-    return std::pair<iterator, bool>{it, inserted};
-  }
-
-  std::pair<iterator, bool> insert_or_assign(const key_type &key,
-                                             const T &obj) {
-    bool inserted{};
-    node_type *tmp = tree_.search(value_type{key, mapped_type{}});
-    if (tmp) {
-      tmp->key_.second = obj;
-    } else {
-      inserted = true;
-      tmp = tree_.insert(value_type{key, obj});
+    return result;
+  }
+
+  template <class M>
+  std::pair<iterator, bool> insert_or_assign(key_type &&key, M &&obj) {
+    auto result = try_emplace(std::move(key), std::forward<M>(obj));
+    if (!result.second) {
+      result.first.iterated_node_->key_.second = std::forward<M>(obj);
     }
-    iterator it(tmp);
-    return std::pair<iterator, bool>{it, inserted};
+    return result;
+  }
+
+  // Constructs the mapped value from args only if key is absent; a single
+  // descent either finds the key or links the new node.
+  template <class... Args>
+  std::pair<iterator, bool> try_emplace(const key_type &key, Args &&...args) {
+    return wrap(tree_.try_emplace(
+        key, std::piecewise_construct, std::forward_as_tuple(key),
+        std::forward_as_tuple(std::forward<Args>(args)...)));
+  }
+
+  template <class... Args>
+  std::pair<iterator, bool> try_emplace(key_type &&key, Args &&...args) {
+    return wrap(tree_.try_emplace(
+        key, std::piecewise_construct, std::forward_as_tuple(std::move(key)),
+        std::forward_as_tuple(std::forward<Args>(args)...)));
   }
 
-  void erase(iterator pos) { tree_.erase(*pos); }
+  template <class... Args>
+  std::pair<iterator, bool> emplace(Args &&...args) {
+    node_type *fresh =
+        new node_type(std::in_place, std::forward<Args>(args)...);
+    return wrap(link(tree_.insert_node(fresh), fresh));
+  }
+
+  // O(1) plus rebalancing when the element belongs right before hint.
+  template <class... Args>
+  iterator emplace_hint(iterator hint, Args &&...args) {
+    node_type *fresh =
+        new node_type(std::in_place, std::forward<Args>(args)...);
+    return iterator(
+        link(tree_.insert_node(hint.iterated_node_, fresh), fresh).first);
+  }
+
+  void erase(iterator pos) {
+    if (pos.iterated_node_) tree_.erase_node(pos.iterated_node_);
+  }
+
+  // Two splits and a join, so O(log n + k) for k erased elements.
+  iterator erase(iterator first, iterator last) {
+    tree_.erase_range(first.iterated_node_, last.iterated_node_);
+    return last;
+  }
+
+  // Erases every element for which pred(element) holds; returns how many.
+  template <class Pred>
+  size_type erase_if(Pred pred) {
+    return tree_.erase_nodes_if(
+        [&pred](node_type *node) { return pred(node->key_); });
+  }
   void swap(Map &other) { std::swap(tree_, other.tree_); }
 
+  // Unlinks the element and hands its node over; nothing is copied.
+  node_handle extract(iterator pos) {
+    if (!pos.iterated_node_) return node_handle();
+    return node_handle(tree_.extract_node(pos.iterated_node_));
+  }
+
+  node_handle extract(const key_type &key) { return extract(find(key)); }
+
+  // Moves over the nodes whose keys are not here yet; the rest stay in other.
   void merge(Map &other) {
-    node_type *inserted_node{};
-    for (auto it = other.begin(); it != other.end();) {
-      inserted_node = tree_.search(value_type{(*it).first, mapped_type{}});
-      if (!inserted_node) {
-        insert(*it);
-        inserted_node =
-            other.tree_.search(value_type{(*it).first, mapped_type{}});
-        ++it;
-        if (other.size() == 1) it = iterator{nullptr};
-        other.erase(iterator{inserted_node});
-      } else {
-        ++it;
-      }
-    }
+    tree_.merge_from(other.tree_, [](node_type *, node_type *) {
+      return false;
+    });
+  }
+
+  iterator find(const key_type &key) { return iterator(tree_.find_key(key)); }
+
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  iterator find(const K &key) {
+    return iterator(tree_.find_key(key));
   }
 
   bool contains(const key_type &key) {
-    auto res = tree_.search(value_type{key, mapped_type{}});
-    return res != nullptr;
+    return tree_.find_key(key) != nullptr;
+  }
+
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  bool contains(const K &key) {
+    return tree_.find_key(key) != nullptr;
+  }
+
+  size_type count(const key_type &key) { return contains(key) ? 1 : 0; }
+
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  size_type count(const K &key) {
+    return contains(key) ? 1 : 0;
+  }
+
+  iterator lower_bound(const key_type &key) {
+    return iterator(tree_.lower_bound_key(key));
+  }
+
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  iterator lower_bound(const K &key) {
+    return iterator(tree_.lower_bound_key(key));
+  }
+
+  iterator upper_bound(const key_type &key) {
+    return iterator(tree_.upper_bound_key(key));
+  }
+
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  iterator upper_bound(const K &key) {
+    return iterator(tree_.upper_bound_key(key));
+  }
+
+  std::pair<iterator, iterator> equal_range(const key_type &key) {
+    return {lower_bound(key), upper_bound(key)};
+  }
+
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  std::pair<iterator, iterator> equal_range(const K &key) {
+    return {lower_bound(key), upper_bound(key)};
+  }
+
+  // Elements with keys in [lo, hi), usable in a range-for loop.
+  TreeRange<iterator> range(const key_type &lo, const key_type &hi) {
+    return tree_.template key_range<iterator>(lo, hi);
+  }
+
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  TreeRange<iterator> range(const K &lo, const K &hi) {
+    return tree_.template key_range<iterator>(lo, hi);
+  }
+
+  // Moves the elements with keys in [lo, hi) into a new Map in O(log n).
+  Map extract_range(const key_type &lo, const key_type &hi) {
+    return take_range(lo, hi);
+  }
+
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  Map extract_range(const K &lo, const K &hi) {
+    return take_range(lo, hi);
+  }
+
+  // In-order slices of about size() / chunks elements cut along subtree
+  // boundaries, so each can be walked on its own thread.
+  s21::Vector<TreeSlice<iterator>> slices(size_type chunks) {
+    return tree_.template partition<TreeSlice<iterator>>(chunks);
+  }
+
+  // ---------------- Order statistics ---------------------
+
+  // Number of elements ordered before key.
+  size_type rank(const key_type &key) { return tree_.rank_key(key); }
+
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  size_type rank(const K &key) {
+    return tree_.rank_key(key);
+  }
+
+  // The k-th smallest element, counting from 0.
+  value_type &select(size_type k) {
+    size_type offset = 0;
+    node_type *found = tree_.select_node(k, offset);
+    if (!found) throw std::out_of_range("Index is out of range");
+    return found->key_;
+  }
+
+  // Iterator to the k-th smallest element or end() if there are fewer.
+  iterator nth_element_iterator(size_type k) {
+    size_type offset = 0;
+    return iterator(tree_.select_node(k, offset));
+  }
+
+  // Number of elements with keys in [lo, hi).
+  size_type count_range(const key_type &lo, const key_type &hi) {
+    return tree_.weight_between(lo, hi);
+  }
+
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  size_type count_range(const K &lo, const K &hi) {
+    return tree_.weight_between(lo, hi);
+  }
+
+  key_compare key_comp() const { return tree_.key_comp(); }
+
+  // Bulk insert: a sorted batch is merged with the tree and the result
+  // rebuilt perfectly balanced in O(n + m). Existing keys are kept.
+  template <class InputIt>
+  void insert_sorted(InputIt first, InputIt last) {
+    bulk_insert(first, last, [](node_type *, node_type *) {});
+  }
+
+  // Bulk insert_or_assign with the same cost: the batch's values replace
+  // existing ones and, within the batch, the last of equal keys wins.
+  template <class InputIt>
+  void upsert_sorted(InputIt first, InputIt last) {
+    bulk_insert(first, last, [](node_type *kept, node_type *dropped) {
+      kept->key_.second = std::move(dropped->key_.second);
+    });
   }
 
   template <class... Args>
@@ -133,7 +322,43 @@ class Map {
   }
 
  private:
-  AVL<value_type, mapped_type> tree_;
+  tree_type tree_;
+
+  template <class K>
+  Map take_range(const K &lo, const K &hi) {
+    Map taken(key_comp());
+    tree_.cut_keys(lo, hi, taken.tree_);
+    return taken;
+  }
+
+  template <class InputIt, class Combine>
+  void bulk_insert(InputIt first, InputIt last, Combine combine) {
+    s21::Vector<node_type *> nodes;
+    try {
+      for (; first != last; ++first) {
+        nodes.push_back(new node_type(std::in_place, *first));
+      }
+    } catch (...) {
+      for (node_type *fresh : nodes) delete fresh;
+      throw;
+    }
+    tree_.bulk_insert(nodes, combine);
+  }
+
+  static mapped_type &at_node(node_type *found) {
+    if (!found) throw std::out_of_range("Key does not exist!");
+    return found->key_.second;
+  }
+
+  static std::pair<iterator, bool> wrap(std::pair<node_type *, bool> result) {
+    return {iterator(result.first), result.second};
+  }
+
+  static std::pair<node_type *, bool> link(
+      std::pair<node_type *, bool> result, node_type *fresh) {
+    if (!result.second) delete fresh;
+    return result;
+  }
 
   template <class U>
   void insert_many_aux(U &&arg) {
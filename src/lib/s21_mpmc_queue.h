@@ -0,0 +1,268 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_MPMC_QUEUE_H
+#define CPP2_S21_CONTAINERS_SRC_MPMC_QUEUE_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+namespace s21 {
+namespace detail {
+constexpr std::size_t kCacheLine = 64;
+
+// Orders a preceding store before the waiter count is read. ThreadSanitizer
+// does not model fences, so sanitized builds use an equivalent RMW instead.
+inline int load_after_fence(std::atomic<int> &counter) {
+#if defined(__SANITIZE_THREAD__)
+  return counter.fetch_add(0, std::memory_order_acq_rel);
+#else
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  return counter.load(std::memory_order_relaxed);
+#endif
+}
+
+inline void cpu_relax(int iteration) {
+  if (iteration > 16) std::this_thread::yield();
+}
+
+// Sleeps a thread until a retried operation succeeds. Wakers pay for the
+// mutex only when somebody is actually parked.
+class Parker {
+ public:
+  template <typename Pred>
+  void wait(Pred ready) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    waiters_.fetch_add(1, std::memory_order_seq_cst);
+    load_after_fence(waiters_);
+    while (!ready()) cv_.wait(lock);
+    waiters_.fetch_sub(1, std::memory_order_relaxed);
+  }
+
+  void notify_one() {
+    if (load_after_fence(waiters_) > 0) {
+      { std::lock_guard<std::mutex> lock(mutex_); }
+      cv_.notify_one();
+    }
+  }
+
+  void notify_all() {
+    if (load_after_fence(waiters_) > 0) {
+      { std::lock_guard<std::mutex> lock(mutex_); }
+      cv_.notify_all();
+    }
+  }
+
+ private:
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::atomic<int> waiters_{0};
+};
+}  // namespace detail
+
+template <typename T>
+class MpmcQueue {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+
+  explicit MpmcQueue(size_type capacity) : mask_(round_up(capacity) - 1) {
+    cells_ = new Cell[mask_ + 1];
+    for (size_type i = 0; i <= mask_; ++i) {
+      cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  MpmcQueue(const MpmcQueue &) = delete;
+  MpmcQueue &operator=(const MpmcQueue &) = delete;
+
+  ~MpmcQueue() {
+    size_type tail = tail_.load(std::memory_order_relaxed);
+    for (size_type pos = head_.load(std::memory_order_relaxed); pos != tail;
+         ++pos) {
+      value(&cells_[pos & mask_])->~value_type();
+    }
+    delete[] cells_;
+  }
+
+  // ---------------- Non-blocking ---------------------
+
+  bool try_push(const_reference value) { return try_emplace(value); }
+  bool try_push(value_type &&value) { return try_emplace(std::move(value)); }
+
+  template <class... Args>
+  bool try_emplace(Args &&...args) {
+    size_type pos = tail_.load(std::memory_order_relaxed);
+    Cell *cell;
+    for (;;) {
+      cell = &cells_[pos & mask_];
+      size_type seq = cell->sequence.load(std::memory_order_acquire);
+      std::intptr_t diff =
+          static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+      if (diff == 0) {
+        if (tail_.compare_exchange_weak(pos, pos + 1,
+                                        std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (diff < 0) {
+        return false;
+      } else {
+        pos = tail_.load(std::memory_order_relaxed);
+      }
+    }
+    new (cell->storage) value_type(std::forward<Args>(args)...);
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    not_empty_.notify_one();
+    return true;
+  }
+
+  bool try_pop(reference out) {
+    size_type pos = head_.load(std::memory_order_relaxed);
+    Cell *cell;
+    for (;;) {
+      cell = &cells_[pos & mask_];
+      size_type seq = cell->sequence.load(std::memory_order_acquire);
+      std::intptr_t diff = static_cast<std::intptr_t>(seq) -
+                           static_cast<std::intptr_t>(pos + 1);
+      if (diff == 0) {
+        if (head_.compare_exchange_weak(pos, pos + 1,
+                                        std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (diff < 0) {
+        return false;
+      } else {
+        pos = head_.load(std::memory_order_relaxed);
+      }
+    }
+    release(cell, pos, out);
+    not_full_.notify_one();
+    return true;
+  }
+
+  // Claims up to max consecutive ready cells with a single CAS on head.
+  template <typename OutputIt>
+  size_type try_pop_bulk(OutputIt out, size_type max) {
+    if (max == 0) return 0;
+    size_type pos = head_.load(std::memory_order_relaxed);
+    size_type count = 0;
+    for (;;) {
+      count = 0;
+      while (count < max && count <= mask_) {
+        size_type seq = cells_[(pos + count) & mask_].sequence.load(
+            std::memory_order_acquire);
+        if (seq != pos + count + 1) break;
+        ++count;
+      }
+      if (count == 0) {
+        size_type seq = cells_[pos & mask_].sequence.load(
+            std::memory_order_acquire);
+        if (static_cast<std::intptr_t>(seq) -
+                static_cast<std::intptr_t>(pos + 1) <
+            0) {
+          return 0;
+        }
+        pos = head_.load(std::memory_order_relaxed);
+      } else if (head_.compare_exchange_weak(pos, pos + count,
+                                             std::memory_order_relaxed)) {
+        break;
+      }
+    }
+    for (size_type i = 0; i < count; ++i, ++out) {
+      release(&cells_[(pos + i) & mask_], pos + i, *out);
+    }
+    not_full_.notify_all();
+    return count;
+  }
+
+  // ---------------- Blocking ---------------------
+
+  void push(const_reference value) { emplace(value); }
+  void push(value_type &&value) { emplace(std::move(value)); }
+
+  template <class... Args>
+  void emplace(Args &&...args) {
+    value_type value(std::forward<Args>(args)...);
+    for (int i = 0; i < kSpinCount; ++i) {
+      if (try_push(std::move(value))) return;
+      detail::cpu_relax(i);
+    }
+    not_full_.wait([&] { return try_push(std::move(value)); });
+  }
+
+  void pop(reference out) {
+    for (int i = 0; i < kSpinCount; ++i) {
+      if (try_pop(out)) return;
+      detail::cpu_relax(i);
+    }
+    not_empty_.wait([&] { return try_pop(out); });
+  }
+
+  // Waits for at least one element, then drains up to max of them.
+  template <typename OutputIt>
+  size_type pop_bulk(OutputIt out, size_type max) {
+    size_type count = 0;
+    for (int i = 0; i < kSpinCount; ++i) {
+      if ((count = try_pop_bulk(out, max)) != 0) return count;
+      detail::cpu_relax(i);
+    }
+    not_empty_.wait([&] { return (count = try_pop_bulk(out, max)) != 0; });
+    return count;
+  }
+
+  // ---------------- Capacity ---------------------
+
+  size_type capacity() const noexcept { return mask_ + 1; }
+
+  size_type size() const noexcept {
+    size_type head = head_.load(std::memory_order_relaxed);
+    size_type tail = tail_.load(std::memory_order_relaxed);
+    return tail > head ? tail - head : 0;
+  }
+
+  bool empty() const noexcept { return size() == 0; }
+
+ private:
+  static constexpr int kSpinCount = 64;
+
+  struct Cell {
+    std::atomic<size_type> sequence;
+    alignas(value_type) unsigned char storage[sizeof(value_type)];
+  };
+
+  static size_type round_up(size_type capacity) {
+    if (capacity < 2) {
+      throw std::invalid_argument("MpmcQueue capacity must be at least 2");
+    }
+    size_type result = 1;
+    while (result < capacity) result <<= 1;
+    return result;
+  }
+
+  static value_type *value(Cell *cell) {
+    return std::launder(reinterpret_cast<value_type *>(cell->storage));
+  }
+
+  template <typename Out>
+  void release(Cell *cell, size_type pos, Out &&out) {
+    value_type *item = value(cell);
+    out = std::move(*item);
+    item->~value_type();
+    cell->sequence.store(pos + mask_ + 1, std::memory_order_release);
+  }
+
+  const size_type mask_;
+  Cell *cells_;
+  alignas(detail::kCacheLine) std::atomic<size_type> head_{0};
+  alignas(detail::kCacheLine) std::atomic<size_type> tail_{0};
+  alignas(detail::kCacheLine) detail::Parker not_empty_;
+  detail::Parker not_full_;
+};
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_MPMC_QUEUE_H
@@ -1,11 +1,17 @@
 #ifndef CPP2_S21_CONTAINERS_SRC_LIB_MULTISET_H
 #define CPP2_S21_CONTAINERS_SRC_LIB_MULTISET_H
 
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
 #include "s21_avl_tree.h"
 
 namespace s21 {
-template <typename Key>
-
+template <typename Key, typename Compare = std::less<Key>>
 class Multiset {
  public:
   class MultIterator;
@@ -14,19 +20,35 @@ class Multiset {
   using key_type = Key;
   using value_type = key_type;
   using multiset_type = std::pair<value_type, int>;
+  using key_compare = Compare;
   using node_type = node<multiset_type, int>;
+  // Each node stands for key_.second equal elements.
+  struct CountWeight {
+    std::size_t operator()(const multiset_type& item) const noexcept {
+      return static_cast<std::size_t>(item.second);
+    }
+  };
+  using tree_type = AVL<multiset_type, int, Compare, CountWeight>;
   using reference = value_type&;
   using const_reference = const value_type&;
   using iterator = MultIterator;
   using const_iterator = MultConstIterator;
+  // A handle carries every occurrence of its key.
+  using node_handle = TreeNodeHandle<node_type, false>;
   using size_type = size_t;
 
   Multiset() : tree_() {}
+  explicit Multiset(const Compare& comp) : tree_(comp) {}
 
   Multiset(std::initializer_list<value_type> const& items) {
-    for (auto it : items) {
-      insert(it);
-    }
+    insert_sorted(items.begin(), items.end());
+  }
+
+  // O(n) from sorted input; anything else is sorted first.
+  template <class InputIt>
+  Multiset(InputIt first, InputIt last, const Compare& comp = Compare())
+      : tree_(comp) {
+    insert_sorted(first, last);
   }
 
   Multiset(const Multiset& m) : tree_(m.tree_) {}
@@ -45,16 +67,39 @@ class Multiset {
   ~Multiset() {}
 
   iterator insert(const value_type& value) {
-    std::pair<value_type, int> set_pair(value, 1);
-    node_type* tmp = tree_.search(set_pair);
-    if (!tmp) {
-      tmp = tree_.insert(set_pair);
+    return count_in(tree_.try_emplace(value, value, 1));
+  }
+
+  iterator insert(value_type&& value) {
+    return count_in(tree_.try_emplace(value, std::move(value), 1));
+  }
+
+  // Relinks an extracted node; if the key is present its occurrences are
+  // added to the existing node instead.
+  iterator insert(node_handle&& handle) {
+    if (handle.empty()) return end();
+    auto result = tree_.insert_node(handle.get());
+    if (result.second) {
+      handle.release();
     } else {
-      tmp->key_.second++;
-      if (!empty()) tree_.set_size(1);
+      result.first->key_.second += handle.get()->key_.second;
+      tree_.reweigh(result.first);
     }
-    return iterator{tmp};
+    return iterator{result.first};
+  }
+
+  template <class... Args>
+  iterator emplace(Args&&... args) {
+    node_type* fresh = make_node(std::forward<Args>(args)...);
+    return count_in(tree_.insert_node(fresh), fresh);
+  }
+
+  template <class... Args>
+  iterator emplace_hint(iterator hint, Args&&... args) {
+    node_type* fresh = make_node(std::forward<Args>(args)...);
+    return count_in(tree_.insert_node(hint.iterated_node_, fresh), fresh);
   }
+
   iterator begin() { return iterator(tree_.begin()); }
   iterator end() { return iterator(tree_.end()); }
 
@@ -65,75 +110,243 @@ class Multiset {
   void clear() { tree_.clear(); }
 
   void erase(iterator pos) {
-    std::pair<value_type, int> set_pair(*(pos),
-                                        pos.iterated_node_->key_.second);
-    node_type* tmp = tree_.search(set_pair);
-    if (tmp) {
-      if (pos.iterated_node_->key_.second > 1) {
-        pos.count_--;
-        tree_.set_size(0);
-      } else {
-        tree_.erase((pos.iterated_node_->key_));
-      }
+    if (!pos.iterated_node_) return;
+    if (pos.iterated_node_->key_.second > 1) {
+      pos.iterated_node_->key_.second--;
+      tree_.reweigh(pos.iterated_node_);
+    } else {
+      tree_.erase_node(pos.iterated_node_);
+    }
+  }
+
+  // Whole nodes inside the range go with two splits and a join, so the cost
+  // is O(log n + k) for k erased nodes.
+  iterator erase(iterator first, iterator last) {
+    node_type* from = first.iterated_node_;
+    node_type* to = last.iterated_node_;
+    if (!from || (from == to && first.count_ >= last.count_)) return last;
+    if (from == to) {
+      from->key_.second -= last.count_ - first.count_;
+      tree_.reweigh(from);
+      iterator position{from};
+      position.count_ = first.count_;
+      return position;
+    }
+    if (first.count_ > 1) {
+      from->key_.second = first.count_ - 1;
+      tree_.reweigh(from);
+      from = from->next;
     }
+    if (to && last.count_ > 1) {
+      to->key_.second -= last.count_ - 1;
+      tree_.reweigh(to);
+    }
+    tree_.erase_range(from, to);
+    return iterator{to};
+  }
+
+  // Erases every element for which pred(element) holds; returns how many.
+  template <class Pred>
+  size_type erase_if(Pred pred) {
+    return tree_.erase_nodes_if(
+        [&pred](node_type* node) { return pred(node->key_.first); });
   }
 
   void swap(Multiset& other) { std::swap(tree_, other.tree_); }
 
+  // Unlinks the node of the element's key together with all its
+  // occurrences; nothing is copied.
+  node_handle extract(iterator pos) {
+    if (!pos.iterated_node_) return node_handle();
+    return node_handle(tree_.extract_node(pos.iterated_node_));
+  }
+
+  node_handle extract(const key_type& key) { return extract(find(key)); }
+
+  // Takes every element of other; nodes of keys present in both are folded.
   void merge(Multiset& other) {
-    node_type* inserted_node{};
-    for (auto it = other.begin(); it != other.end();) {
-      std::pair<value_type, int> Multiset_pair((*it), 0);
-      inserted_node = tree_.search(Multiset_pair);
-      if (!inserted_node) {
-        tree_.insert(Multiset_pair);
-        inserted_node = other.tree_.search(Multiset_pair);
-        ++it;
-        if (other.size() == 1) it = iterator{nullptr};
-        other.erase(iterator{inserted_node});
-      } else {
-        insert(*it);
-        ++it;
-      }
-    }
+    tree_.merge_from(other.tree_, [](node_type* kept, node_type* incoming) {
+      kept->key_.second += incoming->key_.second;
+      return true;
+    });
   }
 
   bool contains(const key_type& key) {
-    std::pair<value_type, int> set_pair(key, 1);
-    auto res = tree_.search(set_pair);
-    return res != nullptr;
+    return tree_.find_key(key) != nullptr;
+  }
+
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  bool contains(const K& key) {
+    return tree_.find_key(key) != nullptr;
+  }
+
+  iterator find(const Key& key) { return iterator{tree_.find_key(key)}; }
+
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  iterator find(const K& key) {
+    return iterator{tree_.find_key(key)};
   }
 
-  iterator find(const Key& key) {
-    std::pair<value_type, int> set_pair(key, 1);
-    node_type* tmp = tree_.search(set_pair);
-    return iterator{tmp};
+  size_type count(const key_type& key) { return occurrences(key); }
+
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  size_type count(const K& key) {
+    return occurrences(key);
   }
 
   iterator lower_bound(const Key& key) {
-    iterator tmp1 = insert(key);
-    iterator tmp2 = tmp1;
-    iterator res = ++tmp2;
-    erase(tmp1);
-    return res;
-  }
-
-  iterator upper_bound(const Key& key) {
-    iterator tmp1 = insert(key);
-    iterator tmp2 = tmp1;
-    iterator res = ++tmp2;
-    if (*(res)) {
-      while (*res && res.iterated_node_->key_.first <= key) {
-        ++res;
-      }
-    }
-    erase(tmp1);
-    return res;
+    return iterator(tree_.lower_bound_key(key));
+  }
+
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  iterator lower_bound(const K& key) {
+    return iterator(tree_.lower_bound_key(key));
+  }
+
+  iterator upper_bound(const key_type& key) {
+    return iterator(tree_.upper_bound_key(key));
+  }
+
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  iterator upper_bound(const K& key) {
+    return iterator(tree_.upper_bound_key(key));
+  }
+
+  std::pair<iterator, iterator> equal_range(const key_type& key) {
+    return {lower_bound(key), upper_bound(key)};
   }
 
-  std::pair<iterator, iterator> equal_range(const Key& key) {
-    return std::pair<iterator, iterator>(lower_bound(key),
-                                         --(upper_bound(key)));
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  std::pair<iterator, iterator> equal_range(const K& key) {
+    return {lower_bound(key), upper_bound(key)};
+  }
+
+  // Elements with keys in [lo, hi), usable in a range-for loop.
+  TreeRange<iterator> range(const key_type& lo, const key_type& hi) {
+    return tree_.template key_range<iterator>(lo, hi);
+  }
+
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  TreeRange<iterator> range(const K& lo, const K& hi) {
+    return tree_.template key_range<iterator>(lo, hi);
+  }
+
+  // Multiset algebra by recursive split and join, O(m log(n/m + 1)) for
+  // m <= n distinct keys. Union adds multiplicities, intersection keeps the
+  // smaller one, difference subtracts and symmetric difference keeps the
+  // absolute difference. The result replaces this multiset and other is
+  // left empty. fork runs the two halves of every large enough step;
+  // s21::ParallelFork from s21_parallel_tree.h runs them as tasks.
+  template <class Fork = SequentialFork>
+  void set_union(Multiset& other, Fork fork = Fork()) {
+    tree_.combine_with(other.tree_, true, true,
+                       [](node_type* mine, node_type* theirs) {
+                         mine->key_.second += theirs->key_.second;
+                         return true;
+                       },
+                       fork);
+  }
+
+  template <class Fork = SequentialFork>
+  void set_intersection(Multiset& other, Fork fork = Fork()) {
+    tree_.combine_with(other.tree_, false, false,
+                       [](node_type* mine, node_type* theirs) {
+                         mine->key_.second =
+                             std::min(mine->key_.second, theirs->key_.second);
+                         return true;
+                       },
+                       fork);
+  }
+
+  template <class Fork = SequentialFork>
+  void set_difference(Multiset& other, Fork fork = Fork()) {
+    tree_.combine_with(other.tree_, true, false,
+                       [](node_type* mine, node_type* theirs) {
+                         mine->key_.second -= theirs->key_.second;
+                         return mine->key_.second > 0;
+                       },
+                       fork);
+  }
+
+  template <class Fork = SequentialFork>
+  void set_symmetric_difference(Multiset& other, Fork fork = Fork()) {
+    tree_.combine_with(other.tree_, true, true,
+                       [](node_type* mine, node_type* theirs) {
+                         mine->key_.second =
+                             std::abs(mine->key_.second - theirs->key_.second);
+                         return mine->key_.second > 0;
+                       },
+                       fork);
+  }
+
+  // Moves the elements in [lo, hi) into a new Multiset in O(log n).
+  Multiset extract_range(const key_type& lo, const key_type& hi) {
+    return take_range(lo, hi);
+  }
+
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  Multiset extract_range(const K& lo, const K& hi) {
+    return take_range(lo, hi);
+  }
+
+  // In-order slices of about size() / chunks elements cut along subtree
+  // boundaries, so each can be walked on its own thread.
+  s21::Vector<TreeSlice<iterator>> slices(size_type chunks) {
+    return tree_.template partition<TreeSlice<iterator>>(chunks);
+  }
+
+  // ---------------- Order statistics ---------------------
+
+  // Number of elements ordered before key.
+  size_type rank(const key_type& key) { return tree_.rank_key(key); }
+
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  size_type rank(const K& key) {
+    return tree_.rank_key(key);
+  }
+
+  // The k-th smallest element, counting from 0.
+  const key_type& select(size_type k) {
+    size_type offset = 0;
+    node_type* found = tree_.select_node(k, offset);
+    if (!found) throw std::out_of_range("Index is out of range");
+    return found->key_.first;
+  }
+
+  // Iterator to the k-th smallest element or end() if there are fewer.
+  iterator nth_element_iterator(size_type k) {
+    size_type offset = 0;
+    iterator it(tree_.select_node(k, offset));
+    it.count_ = static_cast<int>(offset) + 1;
+    return it;
+  }
+
+  // Number of elements with keys in [lo, hi).
+  size_type count_range(const key_type& lo, const key_type& hi) {
+    return tree_.weight_between(lo, hi);
+  }
+
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  size_type count_range(const K& lo, const K& hi) {
+    return tree_.weight_between(lo, hi);
+  }
+
+  key_compare key_comp() const { return tree_.key_comp(); }
+
+  // Bulk insert: equal keys are counted together and a sorted batch is
+  // merged with the tree, then rebuilt perfectly balanced, in O(n + m).
+  template <class InputIt>
+  void insert_sorted(InputIt first, InputIt last) {
+    s21::Vector<node_type*> nodes;
+    try {
+      for (; first != last; ++first) nodes.push_back(make_node(*first));
+    } catch (...) {
+      for (node_type* fresh : nodes) delete fresh;
+      throw;
+    }
+    tree_.bulk_insert(nodes, [](node_type* kept, node_type* dropped) {
+      kept->key_.second += dropped->key_.second;
+    });
   }
 
   template <class... Args>
@@ -150,7 +363,7 @@ class Multiset {
     MultIterator(iterator&& other)
         : iterated_node_(other.iterated_node_), count_(other.count_) {
       other.iterated_node_ = nullptr;
-      count_ = 0;
+      other.count_ = 0;
     }
 
     iterator& operator=(const iterator& other) {
@@ -177,17 +390,8 @@ class Multiset {
           count_++;
           return *this;
         }
-        if (iterated_node_->right) {
-          node_type* min_iter = find_min(iterated_node_->right);
-          iterated_node_ = min_iter;
-        } else {
-          while (iterated_node_->parent != nullptr &&
-                 iterated_node_->parent->key_.first <
-                     iterated_node_->key_.first) {
-            iterated_node_ = iterated_node_->parent;
-          }
-          iterated_node_ = iterated_node_->parent;
-        }
+        iterated_node_ = tree_type::next(iterated_node_);
+        count_ = 1;
       }
       return *this;
     }
@@ -198,39 +402,23 @@ class Multiset {
           count_--;
           return *this;
         }
-        if (iterated_node_->left) {
-          node_type* max_iter = find_max(iterated_node_->left);
-          iterated_node_ = max_iter;
-        } else {
-          while (iterated_node_->parent != nullptr &&
-                 iterated_node_->parent->key_.first >
-                     iterated_node_->key_.first) {
-            iterated_node_ = iterated_node_->parent;
-          }
-          iterated_node_ = iterated_node_->parent;
-        }
+        iterated_node_ = tree_type::prev(iterated_node_);
+        if (iterated_node_) count_ = iterated_node_->key_.second;
       }
       return *this;
     }
 
-    static node_type* find_min(node_type* node) {
-      return node->left ? find_min(node->left) : node;
-    }
-    static node_type* find_max(node_type* node) {
-      return node->right ? find_max(node->right) : node;
-    }
-
     Key& operator*() {
       if (iterated_node_) return iterated_node_->key_.first;
       static Key empty_key_{};
       return empty_key_;
     }
 
-    bool operator!=(const iterator& it) {
+    bool operator!=(const iterator& it) const {
       return iterated_node_ != it.iterated_node_;
     }
 
-    bool operator==(const iterator& it) {
+    bool operator==(const iterator& it) const {
       return iterated_node_ == it.iterated_node_;
     }
 
@@ -250,7 +438,38 @@ class Multiset {
   };
 
  private:
-  AVL<multiset_type, int> tree_;
+  tree_type tree_;
+
+  template <class K>
+  Multiset take_range(const K& lo, const K& hi) {
+    Multiset taken(key_comp());
+    tree_.cut_keys(lo, hi, taken.tree_);
+    return taken;
+  }
+
+  template <class K>
+  size_type occurrences(const K& key) {
+    node_type* found = tree_.find_key(key);
+    return found ? static_cast<size_type>(found->key_.second) : 0;
+  }
+
+  template <class... Args>
+  static node_type* make_node(Args&&... args) {
+    return new node_type(std::in_place, std::piecewise_construct,
+                         std::forward_as_tuple(std::forward<Args>(args)...),
+                         std::forward_as_tuple(1));
+  }
+
+  // A key that is already present gains one more occurrence instead.
+  iterator count_in(std::pair<node_type*, bool> result,
+                    node_type* fresh = nullptr) {
+    if (!result.second) {
+      delete fresh;
+      result.first->key_.second++;
+      tree_.reweigh(result.first);
+    }
+    return iterator{result.first};
+  }
 
   template <class U>
   void insert_many_aux(U&& arg) {
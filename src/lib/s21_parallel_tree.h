@@ -0,0 +1,145 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_PARALLEL_TREE_H
+#define CPP2_S21_CONTAINERS_SRC_PARALLEL_TREE_H
+
+#include <type_traits>
+#include <utility>
+
+#include "s21_task_scheduler.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// Parallel algorithms over Map, Set and Multiset. The container is cut
+// into in-order slices along subtree boundaries (see slices()), several per
+// worker so that stealing evens out the load, and every slice becomes one
+// task. The container must not be modified while they run.
+namespace detail {
+constexpr std::size_t kSlicesPerWorker = 8;
+
+template <typename Container>
+auto tree_slices(TaskScheduler &scheduler, Container &container) {
+  return container.slices(scheduler.size() * kSlicesPerWorker);
+}
+
+template <typename T>
+struct ExportValue {
+  using type = T;
+};
+
+// Map elements have a const key; exported copies do not.
+template <typename K, typename V>
+struct ExportValue<std::pair<const K, V>> {
+  using type = std::pair<K, V>;
+};
+
+// Set iterators yield the node's (key, tag) pair; only the key is exported.
+template <typename Value, typename Element>
+Value export_value(Element &element) {
+  if constexpr (std::is_constructible_v<Value, Element &>) {
+    return Value(element);
+  } else {
+    return Value(element.first);
+  }
+}
+
+template <typename T, typename Fold, typename Element>
+void fold_into(T &acc, const Fold &fold, Element &element) {
+  if constexpr (std::is_void_v<std::invoke_result_t<const Fold &, T &,
+                                                    Element &>>) {
+    fold(acc, element);
+  } else {
+    acc = fold(std::move(acc), element);
+  }
+}
+}  // namespace detail
+
+// Fork policy for the set algebra of Set and Multiset: both halves of every
+// large enough step run through parallel_invoke.
+class ParallelFork {
+ public:
+  explicit ParallelFork(TaskScheduler &scheduler) : scheduler_(&scheduler) {}
+
+  template <typename Less, typename Greater>
+  void operator()(Less &less, Greater &greater) const {
+    parallel_invoke(*scheduler_, less, greater);
+  }
+
+ private:
+  TaskScheduler *scheduler_;
+};
+
+// Calls f(element) for every element. Slices run concurrently, so f must be
+// safe to call from several threads; within a slice the order is kept.
+template <typename Container, typename F>
+void parallel_for_each(TaskScheduler &scheduler, Container &container,
+                       const F &f) {
+  auto slices = detail::tree_slices(scheduler, container);
+  parallel_for(scheduler, slices, 1, [&f](const auto &slice) {
+    for (auto &&element : slice) f(element);
+  });
+}
+
+// Folds every slice from identity with acc = fold(acc, element) and then
+// joins the partial results left to right with combine(acc, partial), so
+// neither needs to be commutative, only associative with identity as the
+// neutral value. A fold that returns void updates acc in place instead,
+// which spares copying a large accumulator per element.
+template <typename Container, typename T, typename Fold, typename Combine>
+T parallel_reduce(TaskScheduler &scheduler, Container &container, T identity,
+                  const Fold &fold, const Combine &combine) {
+  auto slices = detail::tree_slices(scheduler, container);
+  s21::Vector<T> partials(slices.size());
+  parallel_for(scheduler, std::size_t{0}, slices.size(), std::size_t{1},
+               [&](std::size_t i) {
+                 T acc = identity;
+                 for (auto &&element : slices[i]) {
+                   detail::fold_into(acc, fold, element);
+                 }
+                 partials[i] = std::move(acc);
+               });
+  T result = std::move(identity);
+  for (T &partial : partials) {
+    result = combine(std::move(result), std::move(partial));
+  }
+  return result;
+}
+
+template <typename Container, typename T, typename Op>
+T parallel_reduce(TaskScheduler &scheduler, Container &container, T identity,
+                  const Op &op) {
+  return parallel_reduce(scheduler, container, std::move(identity), op, op);
+}
+
+// Copies project(element) for every element into a Vector in container
+// order; each slice writes its own stretch of the output.
+template <typename Container, typename Project>
+auto parallel_export(TaskScheduler &scheduler, Container &container,
+                     const Project &project) {
+  using value_type = std::decay_t<decltype(project(*container.begin()))>;
+  auto slices = detail::tree_slices(scheduler, container);
+  s21::Vector<std::size_t> offsets(slices.size());
+  std::size_t total = 0;
+  for (std::size_t i = 0; i < slices.size(); ++i) {
+    offsets[i] = total;
+    total += slices[i].size();
+  }
+  s21::Vector<value_type> out(total);
+  parallel_for(scheduler, std::size_t{0}, slices.size(), std::size_t{1},
+               [&](std::size_t i) {
+                 std::size_t at = offsets[i];
+                 for (auto &&element : slices[i]) out[at++] = project(element);
+               });
+  return out;
+}
+
+// Exports the container's value_type, e.g. std::pair<K, V> for a Map.
+template <typename Container>
+auto parallel_export(TaskScheduler &scheduler, Container &container) {
+  using value_type =
+      typename detail::ExportValue<typename Container::value_type>::type;
+  return parallel_export(scheduler, container, [](auto &element) {
+    return detail::export_value<value_type>(element);
+  });
+}
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_PARALLEL_TREE_H
@@ -0,0 +1,640 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_PERSISTENT_TREE_H
+#define CPP2_S21_CONTAINERS_SRC_PERSISTENT_TREE_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_vector.h"
+
+namespace s21 {
+template <typename Value>
+struct PersistentNode {
+  template <typename... Args>
+  explicit PersistentNode(Args &&...args)
+      : value(std::forward<Args>(args)...),
+        left(nullptr),
+        right(nullptr),
+        height(1),
+        size(1),
+        refs(1) {}
+
+  Value value;
+  PersistentNode *left;
+  PersistentNode *right;
+  int height;
+  std::size_t size;
+  // Parents and tree roots pointing here. A node is only ever changed in
+  // place while its count is one along the whole path from the root.
+  std::atomic<std::size_t> refs;
+};
+
+// Path-copying AVL tree. Nodes have no parent or neighbour links, so whole
+// subtrees can be shared between versions: copying a tree is O(1) and a
+// write copies only the O(log n) nodes on its path that are still shared.
+// Reference counts are atomic, so a copy may be read and dropped on another
+// thread while the original keeps changing; one tree object itself is not
+// safe to write from two threads.
+template <typename Value, typename KeyOf, typename Compare>
+class PersistentTree : private Compare {
+ public:
+  using node_type = PersistentNode<Value>;
+  using size_type = std::size_t;
+
+  // In-order walk over a fixed version; the stack holds the nodes still to
+  // be visited on the way back up.
+  class Iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Value;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const Value *;
+    using reference = const Value &;
+
+    Iterator() {}
+
+    const Value &operator*() const { return top()->value; }
+    const Value *operator->() const { return &top()->value; }
+
+    Iterator &operator++() {
+      const node_type *node = top()->right;
+      stack_.pop_back();
+      descend_left(node);
+      return *this;
+    }
+
+    bool operator==(const Iterator &other) const {
+      if (stack_.empty() || other.stack_.empty()) {
+        return stack_.empty() && other.stack_.empty();
+      }
+      return top() == other.top();
+    }
+
+    bool operator!=(const Iterator &other) const { return !(*this == other); }
+
+   private:
+    friend class PersistentTree;
+
+    const node_type *top() const { return stack_[stack_.size() - 1]; }
+
+    void descend_left(const node_type *node) {
+      for (; node; node = node->left) stack_.push_back(node);
+    }
+
+    s21::Vector<const node_type *> stack_;
+  };
+
+  explicit PersistentTree(const Compare &comp = Compare())
+      : Compare(comp), root_(nullptr) {}
+
+  PersistentTree(const PersistentTree &other)
+      : Compare(other), root_(retain(other.root_)) {}
+
+  PersistentTree(PersistentTree &&other) noexcept
+      : Compare(std::move(other)), root_(other.root_) {
+    other.root_ = nullptr;
+  }
+
+  PersistentTree &operator=(const PersistentTree &other) {
+    if (this != &other) {
+      node_type *root = retain(other.root_);
+      release(root_);
+      root_ = root;
+      static_cast<Compare &>(*this) = other;
+    }
+    return *this;
+  }
+
+  PersistentTree &operator=(PersistentTree &&other) noexcept {
+    std::swap(root_, other.root_);
+    std::swap(static_cast<Compare &>(*this), static_cast<Compare &>(other));
+    return *this;
+  }
+
+  ~PersistentTree() { release(root_); }
+
+  size_type size() const { return root_ ? root_->size : 0; }
+  bool empty() const { return root_ == nullptr; }
+
+  void clear() {
+    release(root_);
+    root_ = nullptr;
+  }
+
+  const Compare &key_comp() const { return *this; }
+
+  template <typename K>
+  const node_type *find(const K &key) const {
+    const node_type *node = root_;
+    while (node) {
+      if (less(key, KeyOf()(node->value))) {
+        node = node->left;
+      } else if (less(KeyOf()(node->value), key)) {
+        node = node->right;
+      } else {
+        return node;
+      }
+    }
+    return nullptr;
+  }
+
+  Iterator begin() const {
+    Iterator it;
+    it.descend_left(root_);
+    return it;
+  }
+
+  Iterator end() const { return Iterator(); }
+
+  // First element whose key is not ordered before key.
+  template <typename K>
+  Iterator lower_bound(const K &key) const {
+    Iterator it;
+    const node_type *node = root_;
+    while (node) {
+      if (less(KeyOf()(node->value), key)) {
+        node = node->right;
+      } else {
+        it.stack_.push_back(node);
+        node = node->left;
+      }
+    }
+    return it;
+  }
+
+  // Number of elements ordered before key.
+  template <typename K>
+  size_type rank(const K &key) const {
+    size_type rank = 0;
+    const node_type *node = root_;
+    while (node) {
+      if (less(KeyOf()(node->value), key)) {
+        rank += size_of(node->left) + 1;
+        node = node->right;
+      } else {
+        node = node->left;
+      }
+    }
+    return rank;
+  }
+
+  // The k-th smallest element or nullptr if there are fewer.
+  const node_type *select(size_type k) const {
+    const node_type *node = root_;
+    while (node) {
+      size_type left = size_of(node->left);
+      if (k < left) {
+        node = node->left;
+      } else if (k == left) {
+        return node;
+      } else {
+        k -= left + 1;
+        node = node->right;
+      }
+    }
+    return nullptr;
+  }
+
+  // Adds a node built from args unless key is present. Returns the element
+  // with that key and whether it was added; nothing is copied if not.
+  // Whatever may throw runs before the tree changes shape: the new node is
+  // built first, then the path is owned, which leaves the contents as they
+  // were. A failed insert thus leaves the tree valid and unchanged.
+  template <typename K, typename... Args>
+  std::pair<node_type *, bool> try_emplace(const K &key, Args &&...args) {
+    if (const node_type *found = find(key)) {
+      return {const_cast<node_type *>(found), false};
+    }
+    node_type *fresh = new node_type(std::forward<Args>(args)...);
+    Path path;
+    node_type **link = &root_;
+    try {
+      path.reserve(height_of(root_));
+      while (*link) {
+        node_type *node = own(*link);
+        path.push_back(node);
+        link = less(key, KeyOf()(node->value)) ? &node->left : &node->right;
+      }
+    } catch (...) {
+      delete fresh;
+      throw;
+    }
+    *link = fresh;
+    rebalance(path, root_);
+    return {fresh, true};
+  }
+
+  // The node holding key after copying its path, so the caller may change
+  // the non-key part of its value. key must be present.
+  template <typename K>
+  node_type *own_path(const K &key) {
+    node_type **link = &root_;
+    for (;;) {
+      node_type *node = own(*link);
+      if (less(key, KeyOf()(node->value))) {
+        link = &node->left;
+      } else if (less(KeyOf()(node->value), key)) {
+        link = &node->right;
+      } else {
+        return node;
+      }
+    }
+  }
+
+  // Owns every node the removal rewires or a rebalancing rotation may
+  // touch before unlinking anything, so a throwing copy leaves the tree
+  // valid and unchanged, as in try_emplace.
+  template <typename K>
+  bool erase(const K &key) {
+    if (!find(key)) return false;
+    Path path;
+    Path spine;
+    path.reserve(height_of(root_));
+    spine.reserve(height_of(root_));
+    node_type **link = &root_;
+    node_type *found = nullptr;
+    while (!found) {
+      node_type *node = own(*link);
+      if (less(key, KeyOf()(node->value))) {
+        own_rotation(node, true);
+        path.push_back(node);
+        link = &node->left;
+      } else if (less(KeyOf()(node->value), key)) {
+        own_rotation(node, false);
+        path.push_back(node);
+        link = &node->right;
+      } else {
+        found = node;
+      }
+    }
+    node_type *replacement = found->left ? found->left : found->right;
+    if (found->left && found->right) {
+      // The successor takes found's place and its right side shrinks.
+      own_rotation(found, false);
+      node_type **min_link = &found->right;
+      node_type *min = own(*min_link);
+      while (min->left) {
+        own_rotation(min, true);
+        spine.push_back(min);
+        min_link = &min->left;
+        min = own(*min_link);
+      }
+      *min_link = min->right;
+      rebalance(spine, found->right);
+      min->left = found->left;
+      min->right = found->right;
+      replacement = balance(min);
+    }
+    found->left = nullptr;
+    found->right = nullptr;
+    *link = replacement;
+    release(found);
+    rebalance(path, root_);
+    return true;
+  }
+
+ private:
+  using Path = s21::Vector<node_type *>;
+
+  template <typename A, typename B>
+  bool less(const A &a, const B &b) const {
+    return key_comp()(a, b);
+  }
+
+  static node_type *retain(node_type *node) {
+    if (node) node->refs.fetch_add(1, std::memory_order_relaxed);
+    return node;
+  }
+
+  static void release(node_type *node) {
+    while (node && node->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      release(node->left);
+      node_type *right = node->right;
+      delete node;
+      node = right;
+    }
+  }
+
+  // Makes link refer to a node only this tree refers to: the node itself
+  // if nobody else does, else a copy. link's parent must already be owned.
+  // The copy is linked in before the old reference is dropped and holds
+  // the same contents, so the tree stays valid if copying throws.
+  static node_type *own(node_type *&link) {
+    node_type *node = link;
+    if (node->refs.load(std::memory_order_acquire) == 1) return node;
+    node_type *copy = new node_type(node->value);
+    copy->left = retain(node->left);
+    copy->right = retain(node->right);
+    copy->height = node->height;
+    copy->size = node->size;
+    link = copy;
+    release(node);
+    return copy;
+  }
+
+  // Owns what balance() would rotate at node if the named side lost a
+  // level: the taller child and, for a double rotation, its inner child.
+  // Called while owning a path top-down so rebalancing never copies.
+  static void own_rotation(node_type *node, bool left_shrinks) {
+    node_type *&tall = left_shrinks ? node->right : node->left;
+    node_type *shrinking = left_shrinks ? node->left : node->right;
+    if (height_of(tall) <= height_of(shrinking)) return;
+    node_type *pivot = own(tall);
+    node_type *&inner = left_shrinks ? pivot->left : pivot->right;
+    node_type *outer = left_shrinks ? pivot->right : pivot->left;
+    if (height_of(inner) > height_of(outer)) own(inner);
+  }
+
+  static int height_of(const node_type *node) {
+    return node ? node->height : 0;
+  }
+
+  static size_type size_of(const node_type *node) {
+    return node ? node->size : 0;
+  }
+
+  static void update(node_type *node) {
+    node->height = std::max(height_of(node->left), height_of(node->right)) + 1;
+    node->size = size_of(node->left) + size_of(node->right) + 1;
+  }
+
+  static node_type *rotate_left(node_type *node) {
+    node_type *pivot = node->right;
+    node->right = pivot->left;
+    pivot->left = node;
+    update(node);
+    update(pivot);
+    return pivot;
+  }
+
+  static node_type *rotate_right(node_type *node) {
+    node_type *pivot = node->left;
+    node->left = pivot->right;
+    pivot->right = node;
+    update(node);
+    update(pivot);
+    return pivot;
+  }
+
+  // node is owned; the children a rotation rewires are made owned first.
+  // After an insert these are path nodes and after an erase own_rotation
+  // took them, so no copy is made here.
+  static node_type *balance(node_type *node) {
+    update(node);
+    int diff = height_of(node->right) - height_of(node->left);
+    if (diff == 2) {
+      own(node->right);
+      if (height_of(node->right->left) > height_of(node->right->right)) {
+        own(node->right->left);
+        node->right = rotate_right(node->right);
+      }
+      return rotate_left(node);
+    }
+    if (diff == -2) {
+      own(node->left);
+      if (height_of(node->left->right) > height_of(node->left->left)) {
+        own(node->left->right);
+        node->left = rotate_left(node->left);
+      }
+      return rotate_right(node);
+    }
+    return node;
+  }
+
+  // Rebalances owned path bottom-up after the subtree below its last node
+  // changed. path[0] hangs from top and every other node from the one
+  // before it.
+  static void rebalance(const Path &path, node_type *&top) {
+    for (size_type i = path.size(); i-- > 0;) {
+      node_type *node = path[i];
+      node_type *root = balance(node);
+      if (root == node) continue;
+      if (i == 0) {
+        top = root;
+      } else if (path[i - 1]->left == node) {
+        path[i - 1]->left = root;
+      } else {
+        path[i - 1]->right = root;
+      }
+    }
+  }
+
+  node_type *root_;
+};
+
+template <typename Key, typename T>
+struct PersistentMapKey {
+  const Key &operator()(const std::pair<const Key, T> &value) const {
+    return value.first;
+  }
+};
+
+struct PersistentSetKey {
+  template <typename Key>
+  const Key &operator()(const Key &value) const {
+    return value;
+  }
+};
+
+// Read-only version of a PersistentMap. Copying one is O(1), and it stays
+// valid and unchanged however the map it was taken from changes later, so
+// it may be handed to and read by any number of other threads.
+template <typename Key, typename T, typename Compare = std::less<Key>>
+class PersistentMapView {
+ protected:
+  using tree_type =
+      PersistentTree<std::pair<const Key, T>, PersistentMapKey<Key, T>,
+                     Compare>;
+
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using const_reference = const value_type &;
+  using const_iterator = typename tree_type::Iterator;
+  using iterator = const_iterator;
+  using size_type = std::size_t;
+
+  explicit PersistentMapView(const Compare &comp = Compare()) : tree_(comp) {}
+
+  size_type size() const noexcept { return tree_.size(); }
+  bool empty() const noexcept { return tree_.empty(); }
+
+  const_iterator begin() const { return tree_.begin(); }
+  const_iterator end() const { return tree_.end(); }
+
+  const mapped_type &at(const key_type &key) const {
+    auto node = tree_.find(key);
+    if (!node) throw std::out_of_range("Key does not exist!");
+    return node->value.second;
+  }
+
+  bool contains(const key_type &key) const {
+    return tree_.find(key) != nullptr;
+  }
+
+  const_iterator find(const key_type &key) const {
+    return tree_.find(key) ? tree_.lower_bound(key) : end();
+  }
+
+  const_iterator lower_bound(const key_type &key) const {
+    return tree_.lower_bound(key);
+  }
+
+  // Number of keys ordered before key.
+  size_type rank(const key_type &key) const { return tree_.rank(key); }
+
+  const_reference select(size_type index) const {
+    auto node = tree_.select(index);
+    if (!node) throw std::out_of_range("Index is out of range");
+    return node->value;
+  }
+
+ protected:
+  tree_type tree_;
+};
+
+// Map whose copies share structure: copying it and snapshot() are O(1); a
+// write copies only the O(log n) nodes on its path still seen by a copy.
+// Elements are changed through the map's own methods only, so iteration is
+// read-only.
+template <typename Key, typename T, typename Compare = std::less<Key>>
+class PersistentMap : public PersistentMapView<Key, T, Compare> {
+  using base = PersistentMapView<Key, T, Compare>;
+
+ public:
+  using typename base::const_iterator;
+  using typename base::key_type;
+  using typename base::mapped_type;
+  using typename base::size_type;
+  using typename base::value_type;
+  using snapshot_type = base;
+
+  explicit PersistentMap(const Compare &comp = Compare()) : base(comp) {}
+
+  PersistentMap(std::initializer_list<value_type> const &items) : base() {
+    for (const value_type &item : items) insert(item);
+  }
+
+  snapshot_type snapshot() const { return *this; }
+
+  std::pair<const_iterator, bool> insert(const value_type &value) {
+    return insert(value.first, value.second);
+  }
+
+  std::pair<const_iterator, bool> insert(const key_type &key,
+                                         const mapped_type &obj) {
+    bool added = tree_.try_emplace(key, key, obj).second;
+    return {tree_.lower_bound(key), added};
+  }
+
+  std::pair<const_iterator, bool> insert_or_assign(const key_type &key,
+                                                   const mapped_type &obj) {
+    bool added = tree_.try_emplace(key, key, obj).second;
+    if (!added) tree_.own_path(key)->value.second = obj;
+    return {tree_.lower_bound(key), added};
+  }
+
+  // Copies the path to key so the reference may be written through; it is
+  // valid until the next change of the map.
+  mapped_type &operator[](const key_type &key) {
+    tree_.try_emplace(key, key, mapped_type());
+    return tree_.own_path(key)->value.second;
+  }
+
+  size_type erase(const key_type &key) { return tree_.erase(key); }
+
+  void clear() { tree_.clear(); }
+
+  void swap(PersistentMap &other) { std::swap(tree_, other.tree_); }
+
+ private:
+  using base::tree_;
+};
+
+template <typename Key, typename Compare = std::less<Key>>
+class PersistentSetView {
+ protected:
+  using tree_type = PersistentTree<Key, PersistentSetKey, Compare>;
+
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using const_reference = const value_type &;
+  using const_iterator = typename tree_type::Iterator;
+  using iterator = const_iterator;
+  using size_type = std::size_t;
+
+  explicit PersistentSetView(const Compare &comp = Compare()) : tree_(comp) {}
+
+  size_type size() const noexcept { return tree_.size(); }
+  bool empty() const noexcept { return tree_.empty(); }
+
+  const_iterator begin() const { return tree_.begin(); }
+  const_iterator end() const { return tree_.end(); }
+
+  bool contains(const key_type &key) const {
+    return tree_.find(key) != nullptr;
+  }
+
+  const_iterator find(const key_type &key) const {
+    return tree_.find(key) ? tree_.lower_bound(key) : end();
+  }
+
+  const_iterator lower_bound(const key_type &key) const {
+    return tree_.lower_bound(key);
+  }
+
+  size_type rank(const key_type &key) const { return tree_.rank(key); }
+
+  const_reference select(size_type index) const {
+    auto node = tree_.select(index);
+    if (!node) throw std::out_of_range("Index is out of range");
+    return node->value;
+  }
+
+ protected:
+  tree_type tree_;
+};
+
+template <typename Key, typename Compare = std::less<Key>>
+class PersistentSet : public PersistentSetView<Key, Compare> {
+  using base = PersistentSetView<Key, Compare>;
+
+ public:
+  using typename base::const_iterator;
+  using typename base::key_type;
+  using typename base::size_type;
+  using typename base::value_type;
+  using snapshot_type = base;
+
+  explicit PersistentSet(const Compare &comp = Compare()) : base(comp) {}
+
+  PersistentSet(std::initializer_list<value_type> const &items) : base() {
+    for (const value_type &item : items) insert(item);
+  }
+
+  snapshot_type snapshot() const { return *this; }
+
+  std::pair<const_iterator, bool> insert(const value_type &value) {
+    bool added = tree_.try_emplace(value, value).second;
+    return {tree_.lower_bound(value), added};
+  }
+
+  size_type erase(const key_type &key) { return tree_.erase(key); }
+
+  void clear() { tree_.clear(); }
+
+  void swap(PersistentSet &other) { std::swap(tree_, other.tree_); }
+
+ private:
+  using base::tree_;
+};
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_PERSISTENT_TREE_H
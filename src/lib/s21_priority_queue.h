@@ -0,0 +1,308 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_PRIORITY_QUEUE_H
+#define CPP2_S21_CONTAINERS_SRC_PRIORITY_QUEUE_H
+
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_vector.h"
+
+namespace s21 {
+// d-ary heap adaptor. Like std::priority_queue, top() is the element for
+// which Compare says nothing is greater. Arity 4 or 8 keeps all children of
+// a node within one or two cache lines and halves or thirds the depth.
+template <typename T, typename Container = s21::Vector<T>,
+          typename Compare = std::less<T>, std::size_t Arity = 2>
+class PriorityQueue {
+  static_assert(Arity >= 2, "PriorityQueue arity must be at least 2");
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+  using container_type = Container;
+  using value_compare = Compare;
+
+  PriorityQueue() : cont(), comp() {}
+  explicit PriorityQueue(const Compare &compare) : cont(), comp(compare) {}
+
+  // O(n) bottom-up heapify.
+  explicit PriorityQueue(std::initializer_list<value_type> const &items)
+      : PriorityQueue(items.begin(), items.end()) {}
+
+  template <typename InputIt>
+  PriorityQueue(InputIt first, InputIt last, const Compare &compare = Compare())
+      : cont(), comp(compare) {
+    for (; first != last; ++first) cont.push_back(*first);
+    heapify();
+  }
+
+  explicit PriorityQueue(Container &&items, const Compare &compare = Compare())
+      : cont(std::move(items)), comp(compare) {
+    heapify();
+  }
+
+  PriorityQueue(const PriorityQueue &q) : cont(q.cont), comp(q.comp) {}
+  PriorityQueue(PriorityQueue &&q) : cont(std::move(q.cont)), comp(q.comp) {}
+  ~PriorityQueue() {}
+
+  PriorityQueue &operator=(PriorityQueue &&q) {
+    cont = std::move(q.cont);
+    comp = q.comp;
+    return *this;
+  }
+
+  const_reference top() const {
+    if (cont.empty()) throw std::out_of_range("PriorityQueue is empty");
+    return cont[0];
+  }
+
+  bool empty() const { return cont.empty(); }
+  size_type size() const { return cont.size(); }
+
+  void push(const_reference value) {
+    cont.push_back(value);
+    sift_up(cont.size() - 1);
+  }
+
+  void push(value_type &&value) {
+    cont.push_back(std::move(value));
+    sift_up(cont.size() - 1);
+  }
+
+  void pop() {
+    if (cont.empty()) throw std::out_of_range("PriorityQueue is empty");
+    if (cont.size() > 1) {
+      value_type last = std::move(cont[cont.size() - 1]);
+      cont.pop_back();
+      sift_down(0, std::move(last));
+    } else {
+      cont.pop_back();
+    }
+  }
+
+  void swap(PriorityQueue &other) {
+    cont.swap(other.cont);
+    std::swap(comp, other.comp);
+  }
+
+  template <class... Args>
+  void insert_many(Args &&...args) {
+    (push(std::forward<Args>(args)), ...);
+  }
+
+ protected:
+  Container cont;
+  Compare comp;
+
+ private:
+  static size_type parent(size_type i) { return (i - 1) / Arity; }
+  static size_type first_child(size_type i) { return i * Arity + 1; }
+
+  void heapify() {
+    size_type n = cont.size();
+    if (n < 2) return;
+    for (size_type i = parent(n - 1) + 1; i-- > 0;) {
+      value_type value = std::move(cont[i]);
+      sift_down(i, std::move(value));
+    }
+  }
+
+  // Both sifts move a hole instead of swapping, one move per level.
+  void sift_up(size_type i) {
+    value_type value = std::move(cont[i]);
+    while (i > 0) {
+      size_type p = parent(i);
+      if (!comp(cont[p], value)) break;
+      cont[i] = std::move(cont[p]);
+      i = p;
+    }
+    cont[i] = std::move(value);
+  }
+
+  void sift_down(size_type i, value_type &&value) {
+    size_type n = cont.size();
+    for (;;) {
+      size_type child = first_child(i);
+      if (child >= n) break;
+      size_type last = child + Arity < n ? child + Arity : n;
+      size_type best = child;
+      for (++child; child < last; ++child) {
+        if (comp(cont[best], cont[child])) best = child;
+      }
+      if (!comp(value, cont[best])) break;
+      cont[i] = std::move(cont[best]);
+      i = best;
+    }
+    cont[i] = std::move(value);
+  }
+};
+
+// d-ary heap whose elements are addressed by stable handles, so an element
+// can be re-prioritised or removed in O(log n). Handles of popped or erased
+// elements are recycled.
+template <typename T, typename Compare = std::less<T>, std::size_t Arity = 4>
+class IndexedPriorityQueue {
+  static_assert(Arity >= 2, "IndexedPriorityQueue arity must be at least 2");
+
+ public:
+  using value_type = T;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+  using handle_type = std::size_t;
+
+  IndexedPriorityQueue() : comp() {}
+  explicit IndexedPriorityQueue(const Compare &compare) : comp(compare) {}
+
+  bool empty() const { return heap_.empty(); }
+  size_type size() const { return heap_.size(); }
+
+  const_reference top() const {
+    if (heap_.empty()) throw std::out_of_range("PriorityQueue is empty");
+    return values_[heap_[0]];
+  }
+
+  handle_type top_handle() const {
+    if (heap_.empty()) throw std::out_of_range("PriorityQueue is empty");
+    return heap_[0];
+  }
+
+  handle_type push(value_type value) {
+    handle_type handle;
+    if (free_.empty()) {
+      handle = values_.size();
+      values_.push_back(std::move(value));
+      position_.push_back(heap_.size());
+    } else {
+      handle = free_.back();
+      free_.pop_back();
+      values_[handle] = std::move(value);
+      position_[handle] = heap_.size();
+    }
+    heap_.push_back(handle);
+    sift_up(heap_.size() - 1);
+    return handle;
+  }
+
+  void pop() { erase(top_handle()); }
+
+  bool contains(handle_type handle) const {
+    return handle < position_.size() && position_[handle] != kAbsent;
+  }
+
+  const_reference value(handle_type handle) const {
+    check(handle);
+    return values_[handle];
+  }
+
+  // Moves the element towards the top: the new value must not have lower
+  // priority than the old one (for std::greater, a smaller key).
+  void decrease_key(handle_type handle, value_type value) {
+    check(handle);
+    if (comp(value, values_[handle])) {
+      throw std::invalid_argument("decrease_key would lower the priority");
+    }
+    values_[handle] = std::move(value);
+    sift_up(position_[handle]);
+  }
+
+  // Sets a new value in either direction.
+  void update(handle_type handle, value_type value) {
+    check(handle);
+    bool up = comp(values_[handle], value);
+    values_[handle] = std::move(value);
+    if (up) {
+      sift_up(position_[handle]);
+    } else {
+      sift_down(position_[handle]);
+    }
+  }
+
+  void erase(handle_type handle) {
+    check(handle);
+    size_type i = position_[handle];
+    size_type last = heap_.size() - 1;
+    position_[handle] = kAbsent;
+    free_.push_back(handle);
+    if (i != last) {
+      heap_[i] = heap_[last];
+      position_[heap_[i]] = i;
+      heap_.pop_back();
+      if (i > 0 && comp(values_[heap_[parent(i)]], values_[heap_[i]])) {
+        sift_up(i);
+      } else {
+        sift_down(i);
+      }
+    } else {
+      heap_.pop_back();
+    }
+  }
+
+  void clear() {
+    heap_.clear();
+    values_.clear();
+    position_.clear();
+    free_.clear();
+  }
+
+ private:
+  static constexpr size_type kAbsent = static_cast<size_type>(-1);
+
+  static size_type parent(size_type i) { return (i - 1) / Arity; }
+  static size_type first_child(size_type i) { return i * Arity + 1; }
+
+  void check(handle_type handle) const {
+    if (!contains(handle)) {
+      throw std::out_of_range("PriorityQueue handle is not in the queue");
+    }
+  }
+
+  bool less(size_type a, size_type b) const {
+    return comp(values_[heap_[a]], values_[heap_[b]]);
+  }
+
+  void place(size_type i, handle_type handle) {
+    heap_[i] = handle;
+    position_[handle] = i;
+  }
+
+  void sift_up(size_type i) {
+    handle_type moving = heap_[i];
+    while (i > 0) {
+      size_type p = parent(i);
+      if (!comp(values_[heap_[p]], values_[moving])) break;
+      place(i, heap_[p]);
+      i = p;
+    }
+    place(i, moving);
+  }
+
+  void sift_down(size_type i) {
+    handle_type moving = heap_[i];
+    size_type n = heap_.size();
+    for (;;) {
+      size_type child = first_child(i);
+      if (child >= n) break;
+      size_type last = child + Arity < n ? child + Arity : n;
+      size_type best = child;
+      for (++child; child < last; ++child) {
+        if (less(best, child)) best = child;
+      }
+      if (!comp(values_[moving], values_[heap_[best]])) break;
+      place(i, heap_[best]);
+      i = best;
+    }
+    place(i, moving);
+  }
+
+  Compare comp;
+  s21::Vector<handle_type> heap_;
+  s21::Vector<value_type> values_;
+  s21::Vector<size_type> position_;
+  s21::Vector<handle_type> free_;
+};
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_PRIORITY_QUEUE_H
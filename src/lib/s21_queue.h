@@ -26,13 +26,14 @@ class Queue {
     return *this;
   }
 
-  const_reference front() { return cont.front(); }
-  const_reference back() { return cont.back(); }
+  reference front() { return cont.front(); }
+  reference back() { return cont.back(); }
 
   bool empty() { return cont.empty(); }
   size_type size() { return cont.size(); }
 
   void push(const_reference value) { this->cont.push_back(value); }
+  void push(value_type &&value) { this->cont.push_back(std::move(value)); }
   void pop() { this->cont.pop_front(); }
   void swap(Queue &other) { this->cont.swap(other.cont); }
 
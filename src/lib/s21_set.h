@@ -1,10 +1,15 @@
 #ifndef CPP2_S21_CONTAINERS_SRC_LIB_SET_H
 #define CPP2_S21_CONTAINERS_SRC_LIB_SET_H
 
+#include <functional>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
 #include "s21_avl_tree.h"
 
 namespace s21 {
-template <typename Key>
+template <typename Key, typename Compare = std::less<Key>>
 class Set {
  public:
   using key_type = Key;
@@ -12,18 +17,27 @@ class Set {
   using set_type = std::pair<value_type, int>;
   using reference = value_type &;
   using const_reference = const value_type &;
+  using key_compare = Compare;
   using node_type = node<set_type, int>;
-  using iterator = typename AVL<set_type, int>::Iterator;
-  using const_iterator = typename AVL<set_type, int>::ConstIterator;
+  using tree_type = AVL<set_type, int, Compare>;
+  using iterator = typename tree_type::Iterator;
+  using const_iterator = typename tree_type::ConstIterator;
+  using node_handle = TreeNodeHandle<node_type, false>;
+  using insert_return_type = TreeInsertReturn<iterator, node_handle>;
   using size_type = size_t;
 
   Set() : tree_() {}
+  explicit Set(const Compare &comp) : tree_(comp) {}
 
   Set(std::initializer_list<value_type> const &items) {
-    for (auto it : items) {
-      std::pair<value_type, int> set_pair(it, 0);
-      tree_.insert(set_pair);
-    }
+    insert_sorted(items.begin(), items.end());
+  }
+
+  // O(n) from sorted input; anything else is sorted and deduplicated first.
+  template <class InputIt>
+  Set(InputIt first, InputIt last, const Compare &comp = Compare())
+      : tree_(comp) {
+    insert_sorted(first, last);
   }
 
   Set(const Set &m) : tree_(m.tree_) {}
@@ -51,45 +65,227 @@ class Set {
   void clear() { tree_.clear(); }
 
   std::pair<iterator, bool> insert(const value_type &value) {
-    bool inserted{};
-    std::pair<value_type, int> set_pair(value, 0);
-    node_type *tmp = tree_.search(set_pair);
-    if (!tmp) {
-      inserted = true;
-      tmp = tree_.insert(set_pair);
+    return wrap(tree_.try_emplace(value, value, 0));
+  }
+
+  std::pair<iterator, bool> insert(value_type &&value) {
+    return wrap(tree_.try_emplace(value, std::move(value), 0));
+  }
+
+  // Relinks an extracted node. If the key is taken, the handle comes back in
+  // the result still owning its node.
+  insert_return_type insert(node_handle &&handle) {
+    if (handle.empty()) return {end(), false, node_handle()};
+    auto result = tree_.insert_node(handle.get());
+    if (!result.second) {
+      return {iterator(result.first), false, std::move(handle)};
     }
-    iterator it(tmp);
-    return std::pair<iterator, bool>{it, inserted};
+    handle.release();
+    return {iterator(result.first), true, node_handle()};
+  }
+
+  template <class... Args>
+  std::pair<iterator, bool> emplace(Args &&...args) {
+    node_type *fresh = make_node(std::forward<Args>(args)...);
+    return wrap(link(tree_.insert_node(fresh), fresh));
   }
 
-  void erase(iterator pos) { tree_.erase(*pos); }
+  template <class... Args>
+  iterator emplace_hint(iterator hint, Args &&...args) {
+    node_type *fresh = make_node(std::forward<Args>(args)...);
+    return iterator(
+        link(tree_.insert_node(hint.iterated_node_, fresh), fresh).first);
+  }
+
+  void erase(iterator pos) {
+    if (pos.iterated_node_) tree_.erase_node(pos.iterated_node_);
+  }
+
+  // Two splits and a join, so O(log n + k) for k erased elements.
+  iterator erase(iterator first, iterator last) {
+    tree_.erase_range(first.iterated_node_, last.iterated_node_);
+    return last;
+  }
+
+  // Erases every element for which pred(element) holds; returns how many.
+  template <class Pred>
+  size_type erase_if(Pred pred) {
+    return tree_.erase_nodes_if(
+        [&pred](node_type *node) { return pred(node->key_.first); });
+  }
   void swap(Set &other) { std::swap(tree_, other.tree_); }
 
+  // Unlinks the element and hands its node over; nothing is copied.
+  node_handle extract(iterator pos) {
+    if (!pos.iterated_node_) return node_handle();
+    return node_handle(tree_.extract_node(pos.iterated_node_));
+  }
+
+  node_handle extract(const key_type &key) { return extract(find(key)); }
+
+  // Moves over the nodes whose keys are not here yet; the rest stay in other.
   void merge(Set &other) {
-    node_type *inserted_node{};
-    for (auto it = other.begin(); it != other.end();) {
-      std::pair<value_type, int> set_pair((*it).first, 0);
-      inserted_node = tree_.search(set_pair);
-      if (!inserted_node) {
-        tree_.insert(set_pair);
-        inserted_node = other.tree_.search(set_pair);
-        ++it;
-        if (other.size() == 1) it = iterator{nullptr};
-        other.erase(iterator{inserted_node});
-      } else {
-        ++it;
-      }
-    }
+    tree_.merge_from(other.tree_, [](node_type *, node_type *) {
+      return false;
+    });
   }
 
   bool contains(const key_type &key) {
-    auto res = tree_.search(set_type{key, 0});
-    return res != nullptr;
+    return tree_.find_key(key) != nullptr;
+  }
+
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  bool contains(const K &key) {
+    return tree_.find_key(key) != nullptr;
+  }
+
+  iterator find(const Key &key) { return iterator{tree_.find_key(key)}; }
+
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  iterator find(const K &key) {
+    return iterator{tree_.find_key(key)};
+  }
+
+  size_type count(const key_type &key) { return contains(key) ? 1 : 0; }
+
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  size_type count(const K &key) {
+    return contains(key) ? 1 : 0;
+  }
+
+  iterator lower_bound(const key_type &key) {
+    return iterator(tree_.lower_bound_key(key));
+  }
+
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  iterator lower_bound(const K &key) {
+    return iterator(tree_.lower_bound_key(key));
+  }
+
+  iterator upper_bound(const key_type &key) {
+    return iterator(tree_.upper_bound_key(key));
+  }
+
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  iterator upper_bound(const K &key) {
+    return iterator(tree_.upper_bound_key(key));
+  }
+
+  std::pair<iterator, iterator> equal_range(const key_type &key) {
+    return {lower_bound(key), upper_bound(key)};
+  }
+
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  std::pair<iterator, iterator> equal_range(const K &key) {
+    return {lower_bound(key), upper_bound(key)};
+  }
+
+  // Elements with keys in [lo, hi), usable in a range-for loop.
+  TreeRange<iterator> range(const key_type &lo, const key_type &hi) {
+    return tree_.template key_range<iterator>(lo, hi);
+  }
+
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  TreeRange<iterator> range(const K &lo, const K &hi) {
+    return tree_.template key_range<iterator>(lo, hi);
+  }
+
+  // Set algebra by recursive split and join, O(m log(n/m + 1)) for sizes
+  // m <= n. The result replaces this set and other is left empty. fork runs
+  // the two halves of every large enough step; s21::ParallelFork from
+  // s21_parallel_tree.h runs them as tasks.
+  template <class Fork = SequentialFork>
+  void set_union(Set &other, Fork fork = Fork()) {
+    tree_.combine_with(other.tree_, true, true,
+                       [](node_type *, node_type *) { return true; },
+                       fork);
+  }
+
+  template <class Fork = SequentialFork>
+  void set_intersection(Set &other, Fork fork = Fork()) {
+    tree_.combine_with(other.tree_, false, false,
+                       [](node_type *, node_type *) { return true; },
+                       fork);
+  }
+
+  template <class Fork = SequentialFork>
+  void set_difference(Set &other, Fork fork = Fork()) {
+    tree_.combine_with(other.tree_, true, false,
+                       [](node_type *, node_type *) { return false; },
+                       fork);
+  }
+
+  template <class Fork = SequentialFork>
+  void set_symmetric_difference(Set &other, Fork fork = Fork()) {
+    tree_.combine_with(other.tree_, true, true,
+                       [](node_type *, node_type *) { return false; },
+                       fork);
+  }
+
+  // Moves the elements in [lo, hi) into a new Set in O(log n).
+  Set extract_range(const key_type &lo, const key_type &hi) {
+    return take_range(lo, hi);
+  }
+
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  Set extract_range(const K &lo, const K &hi) {
+    return take_range(lo, hi);
+  }
+
+  // In-order slices of about size() / chunks elements cut along subtree
+  // boundaries, so each can be walked on its own thread.
+  s21::Vector<TreeSlice<iterator>> slices(size_type chunks) {
+    return tree_.template partition<TreeSlice<iterator>>(chunks);
+  }
+
+  // ---------------- Order statistics ---------------------
+
+  // Number of elements ordered before key.
+  size_type rank(const key_type &key) { return tree_.rank_key(key); }
+
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  size_type rank(const K &key) {
+    return tree_.rank_key(key);
+  }
+
+  // The k-th smallest element, counting from 0.
+  const key_type &select(size_type k) {
+    size_type offset = 0;
+    node_type *found = tree_.select_node(k, offset);
+    if (!found) throw std::out_of_range("Index is out of range");
+    return found->key_.first;
+  }
+
+  // Iterator to the k-th smallest element or end() if there are fewer.
+  iterator nth_element_iterator(size_type k) {
+    size_type offset = 0;
+    return iterator(tree_.select_node(k, offset));
   }
 
-  iterator find(const Key &key) {
-    node_type *res = tree_.search(set_type{key, 0});
-    return iterator{res};
+  // Number of elements with keys in [lo, hi).
+  size_type count_range(const key_type &lo, const key_type &hi) {
+    return tree_.weight_between(lo, hi);
+  }
+
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  size_type count_range(const K &lo, const K &hi) {
+    return tree_.weight_between(lo, hi);
+  }
+
+  key_compare key_comp() const { return tree_.key_comp(); }
+
+  // Bulk insert: a sorted batch is merged with the tree and the result
+  // rebuilt perfectly balanced in O(n + m).
+  template <class InputIt>
+  void insert_sorted(InputIt first, InputIt last) {
+    s21::Vector<node_type *> nodes;
+    try {
+      for (; first != last; ++first) nodes.push_back(make_node(*first));
+    } catch (...) {
+      for (node_type *fresh : nodes) delete fresh;
+      throw;
+    }
+    tree_.bulk_insert(nodes, [](node_type *, node_type *) {});
   }
 
   template <class... Args>
@@ -98,7 +294,31 @@ class Set {
   }
 
  private:
-  AVL<set_type, int> tree_;
+  tree_type tree_;
+
+  template <class K>
+  Set take_range(const K &lo, const K &hi) {
+    Set taken(key_comp());
+    tree_.cut_keys(lo, hi, taken.tree_);
+    return taken;
+  }
+
+  template <class... Args>
+  static node_type *make_node(Args &&...args) {
+    return new node_type(std::in_place, std::piecewise_construct,
+                         std::forward_as_tuple(std::forward<Args>(args)...),
+                         std::forward_as_tuple(0));
+  }
+
+  static std::pair<iterator, bool> wrap(std::pair<node_type *, bool> result) {
+    return {iterator(result.first), result.second};
+  }
+
+  static std::pair<node_type *, bool> link(
+      std::pair<node_type *, bool> result, node_type *fresh) {
+    if (!result.second) delete fresh;
+    return result;
+  }
 
   template <class U>
   void insert_many_aux(U &&arg) {
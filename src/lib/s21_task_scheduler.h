@@ -0,0 +1,299 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_TASK_SCHEDULER_H
+#define CPP2_S21_CONTAINERS_SRC_TASK_SCHEDULER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "s21_queue.h"
+#include "s21_vector.h"
+#include "s21_work_stealing_deque.h"
+
+namespace s21 {
+class TaskGroup;
+
+// Work-stealing pool: every worker owns a WorkStealingDeque, spawns from a
+// worker go to its own deque, idle workers steal from random victims and
+// park on a condition variable when nothing is left. Threads that are not
+// workers submit through a shared injection queue and help while waiting.
+class TaskScheduler {
+ public:
+  using size_type = std::size_t;
+
+  explicit TaskScheduler(size_type threads = default_threads())
+      : workers_(threads ? threads : 1),
+        stop_(false),
+        injected_(0),
+        signals_(0),
+        sleepers_(0) {
+    for (size_type i = 0; i < workers_.size(); ++i) {
+      workers_[i] = new Worker(i);
+    }
+    for (size_type i = 0; i < workers_.size(); ++i) {
+      workers_[i]->thread = std::thread([this, i] { worker_loop(i); });
+    }
+  }
+
+  TaskScheduler(const TaskScheduler &) = delete;
+  TaskScheduler &operator=(const TaskScheduler &) = delete;
+
+  // All task groups must be synced before the scheduler goes away.
+  ~TaskScheduler() {
+    {
+      std::lock_guard<std::mutex> lock(sleep_mutex_);
+      stop_.store(true, std::memory_order_seq_cst);
+    }
+    wake_.notify_all();
+    for (Worker *worker : workers_) worker->thread.join();
+    for (Worker *worker : workers_) delete worker;
+  }
+
+  size_type size() const noexcept { return workers_.size(); }
+
+  static size_type default_threads() {
+    size_type threads = std::thread::hardware_concurrency();
+    return threads ? threads : 1;
+  }
+
+ private:
+  friend class TaskGroup;
+
+  struct Task {
+    std::function<void()> body;
+    TaskGroup *group;
+  };
+
+  struct Worker {
+    explicit Worker(size_type i) : index(i) {}
+    size_type index;
+    WorkStealingDeque<Task *> deque;
+    std::thread thread;
+  };
+
+  struct Context {
+    TaskScheduler *owner;
+    Worker *worker;
+    std::uint64_t seed;
+  };
+
+  static Context &context() {
+    static thread_local Context current{
+        nullptr, nullptr,
+        std::hash<std::thread::id>{}(std::this_thread::get_id()) | 1};
+    return current;
+  }
+
+  Worker *current_worker() {
+    Context &current = context();
+    return current.owner == this ? current.worker : nullptr;
+  }
+
+  void submit(Task *task) {
+    if (Worker *self = current_worker()) {
+      self->deque.push(task);
+    } else {
+      std::lock_guard<std::mutex> lock(inject_mutex_);
+      injected_queue_.push(task);
+      injected_.fetch_add(1, std::memory_order_release);
+    }
+    signals_.fetch_add(1, std::memory_order_seq_cst);
+    if (sleepers_.load(std::memory_order_seq_cst) > 0) {
+      { std::lock_guard<std::mutex> lock(sleep_mutex_); }
+      wake_.notify_one();
+    }
+  }
+
+  bool take_injected(Task *&task) {
+    if (injected_.load(std::memory_order_acquire) == 0) return false;
+    std::lock_guard<std::mutex> lock(inject_mutex_);
+    if (injected_queue_.empty()) return false;
+    task = injected_queue_.front();
+    injected_queue_.pop();
+    injected_.fetch_sub(1, std::memory_order_relaxed);
+    return true;
+  }
+
+  bool steal(Worker *self, Task *&task) {
+    size_type count = workers_.size();
+    std::uint64_t &seed = context().seed;
+    seed ^= seed << 13;
+    seed ^= seed >> 7;
+    seed ^= seed << 17;
+    size_type start = static_cast<size_type>(seed % count);
+    for (size_type i = 0; i < count; ++i) {
+      Worker *victim = workers_[(start + i) % count];
+      if (victim != self && victim->deque.steal(task)) return true;
+    }
+    return false;
+  }
+
+  // Finds and runs one task: own deque, then injected work, then stealing.
+  bool run_one(Worker *self) {
+    Task *task = nullptr;
+    if ((self && self->deque.pop(task)) || take_injected(task) ||
+        steal(self, task)) {
+      execute(task);
+      return true;
+    }
+    return false;
+  }
+
+  inline void execute(Task *task);
+
+  void worker_loop(size_type index) {
+    Worker *self = workers_[index];
+    context().owner = this;
+    context().worker = self;
+    while (!stop_.load(std::memory_order_acquire)) {
+      std::uint64_t seen = signals_.load(std::memory_order_seq_cst);
+      if (run_one(self)) continue;
+      bool found = false;
+      for (int spin = 0; spin < kSpins && !found; ++spin) {
+        std::this_thread::yield();
+        found = run_one(self);
+      }
+      if (found) continue;
+      std::unique_lock<std::mutex> lock(sleep_mutex_);
+      sleepers_.fetch_add(1, std::memory_order_seq_cst);
+      wake_.wait(lock, [this, seen] {
+        return stop_.load(std::memory_order_seq_cst) ||
+               signals_.load(std::memory_order_seq_cst) != seen;
+      });
+      sleepers_.fetch_sub(1, std::memory_order_seq_cst);
+    }
+    context().owner = nullptr;
+    context().worker = nullptr;
+  }
+
+  static constexpr int kSpins = 32;
+
+  s21::Vector<Worker *> workers_;
+  std::atomic<bool> stop_;
+  std::mutex inject_mutex_;
+  s21::Queue<Task *> injected_queue_;
+  std::atomic<size_type> injected_;
+  std::atomic<std::uint64_t> signals_;
+  std::atomic<size_type> sleepers_;
+  std::mutex sleep_mutex_;
+  std::condition_variable wake_;
+};
+
+// Fork-join scope. spawn() forks, sync() joins and rethrows the first
+// exception a task threw. The waiting thread runs other tasks meanwhile.
+class TaskGroup {
+ public:
+  explicit TaskGroup(TaskScheduler &scheduler)
+      : scheduler_(scheduler), pending_(0), failed_(false) {}
+  TaskGroup(const TaskGroup &) = delete;
+  TaskGroup &operator=(const TaskGroup &) = delete;
+
+  ~TaskGroup() {
+    while (pending_.load(std::memory_order_acquire) != 0) help();
+  }
+
+  template <typename F>
+  void spawn(F &&body) {
+    pending_.fetch_add(1, std::memory_order_relaxed);
+    scheduler_.submit(new TaskScheduler::Task{std::forward<F>(body), this});
+  }
+
+  void sync() {
+    while (pending_.load(std::memory_order_acquire) != 0) help();
+    if (failed_.load(std::memory_order_acquire)) {
+      failed_.store(false, std::memory_order_relaxed);
+      std::exception_ptr error = std::move(error_);
+      error_ = nullptr;
+      std::rethrow_exception(error);
+    }
+  }
+
+ private:
+  friend class TaskScheduler;
+
+  void help() {
+    if (!scheduler_.run_one(scheduler_.current_worker())) {
+      std::this_thread::yield();
+    }
+  }
+
+  void finish(std::exception_ptr error) {
+    if (error) {
+      std::lock_guard<std::mutex> lock(error_mutex_);
+      if (!failed_.load(std::memory_order_relaxed)) {
+        error_ = error;
+        failed_.store(true, std::memory_order_release);
+      }
+    }
+    pending_.fetch_sub(1, std::memory_order_acq_rel);
+  }
+
+  TaskScheduler &scheduler_;
+  std::atomic<std::size_t> pending_;
+  std::atomic<bool> failed_;
+  std::mutex error_mutex_;
+  std::exception_ptr error_;
+};
+
+inline void TaskScheduler::execute(Task *task) {
+  std::exception_ptr error;
+  try {
+    task->body();
+  } catch (...) {
+    error = std::current_exception();
+  }
+  TaskGroup *group = task->group;
+  delete task;
+  group->finish(error);
+}
+
+namespace detail {
+template <typename Index, typename F>
+void parallel_for_split(TaskGroup &group, Index first, Index last, Index grain,
+                        const F &body) {
+  while (last - first > grain) {
+    Index middle = first + (last - first) / 2;
+    group.spawn([&group, middle, last, grain, &body] {
+      parallel_for_split(group, middle, last, grain, body);
+    });
+    last = middle;
+  }
+  for (; first < last; ++first) body(first);
+}
+}  // namespace detail
+
+// Runs first as a task other workers may steal and second on the calling
+// thread, and returns once both are done.
+template <typename F, typename G>
+void parallel_invoke(TaskScheduler &scheduler, F &&first, G &&second) {
+  TaskGroup group(scheduler);
+  group.spawn(std::forward<F>(first));
+  second();
+  group.sync();
+}
+
+// Calls body(i) for every i in [first, last), splitting the range in halves
+// until chunks are at most grain long.
+template <typename Index, typename F>
+void parallel_for(TaskScheduler &scheduler, Index first, Index last,
+                  Index grain, const F &body) {
+  if (!(first < last)) return;
+  if (grain < 1) grain = 1;
+  TaskGroup group(scheduler);
+  detail::parallel_for_split(group, first, last, grain, body);
+  group.sync();
+}
+
+template <typename T, typename F>
+void parallel_for(TaskScheduler &scheduler, s21::Vector<T> &vector,
+                  std::size_t grain, const F &body) {
+  parallel_for(scheduler, std::size_t{0}, vector.size(), grain,
+               [&vector, &body](std::size_t i) { body(vector[i]); });
+}
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_TASK_SCHEDULER_H
@@ -0,0 +1,357 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_TIMER_WHEEL_H
+#define CPP2_S21_CONTAINERS_SRC_TIMER_WHEEL_H
+
+#include <cstdint>
+#include <utility>
+
+#include "s21_map.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// Hierarchical timing wheel (Varghese & Lauck). Level l has 256 slots of
+// 256^l ticks each; a timer lives in the lowest level whose span covers its
+// distance to the current tick and drops one level each time that slot
+// comes round. Slots are intrusive doubly linked lists over a node pool
+// addressed by index, so schedule, cancel and reschedule are O(1) and do
+// not allocate once the pool has grown.
+template <typename T>
+class TimerWheel {
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using tick_type = std::uint64_t;
+  // Index and generation of a pool node; stale handles are rejected.
+  using handle_type = std::uint64_t;
+
+  explicit TimerWheel(tick_type now = 0) : now_(now), size_(0), free_(kNil) {
+    for (auto &level : slots_) {
+      for (auto &slot : level) slot = List{kNil, kNil};
+    }
+    overflow_ = List{kNil, kNil};
+    due_ = List{kNil, kNil};
+    for (auto &count : counts_) count = 0;
+  }
+
+  tick_type now() const noexcept { return now_; }
+  size_type size() const noexcept { return size_; }
+  bool empty() const noexcept { return size_ == 0; }
+
+  // A deadline that is not in the future fires on the next advance().
+  handle_type schedule(tick_type deadline, value_type value) {
+    std::uint32_t index = allocate();
+    Node &node = nodes_[index];
+    node.value = std::move(value);
+    node.deadline = deadline;
+    place(index);
+    ++size_;
+    return pack(index, node.generation);
+  }
+
+  bool cancel(handle_type handle) {
+    std::uint32_t index;
+    if (!resolve(handle, index)) return false;
+    unlink(index);
+    release(index);
+    --size_;
+    return true;
+  }
+
+  bool reschedule(handle_type handle, tick_type deadline) {
+    std::uint32_t index;
+    if (!resolve(handle, index)) return false;
+    unlink(index);
+    nodes_[index].deadline = deadline;
+    place(index);
+    return true;
+  }
+
+  bool contains(handle_type handle) const {
+    std::uint32_t index;
+    return resolve(handle, index);
+  }
+
+  // Moves time forward to now and calls expired(value) for every timer whose
+  // deadline passed, in deadline order across ticks.
+  template <typename F>
+  size_type advance(tick_type now, F &&expired) {
+    size_type fired = fire_due(expired);
+    while (now_ < now) {
+      if (size_ == 0) {
+        now_ = now;
+        break;
+      }
+      // Lower levels are empty, so nothing happens before the next slot of
+      // the lowest occupied level comes round; jump straight to it.
+      unsigned level = 0;
+      while (level < kLevels && counts_[level] == 0) ++level;
+      tick_type boundary = (now_ | ((tick_type{1} << (kBits * level)) - 1)) + 1;
+      if (boundary > now) {
+        now_ = now;
+        break;
+      }
+      now_ = boundary;
+      if ((now_ & kMask) == 0) {
+        cascade(1);
+        // Timers due exactly on the boundary cascade straight into due_.
+        fired += fire_due(expired);
+      }
+      fired += fire_slot(slots_[0][now_ & kMask], 0, expired);
+    }
+    return fired;
+  }
+
+  // Appends expired values to out and returns how many were added.
+  size_type advance(tick_type now, s21::Vector<value_type> &out) {
+    return advance(now, [&out](value_type &value) {
+      out.push_back(std::move(value));
+    });
+  }
+
+ private:
+  static constexpr std::uint32_t kNil = 0xFFFFFFFFu;
+  static constexpr unsigned kLevels = 4;
+  static constexpr unsigned kBits = 8;
+  static constexpr tick_type kSlots = tick_type{1} << kBits;
+  static constexpr tick_type kMask = kSlots - 1;
+  static constexpr unsigned kOverflow = kLevels;
+  static constexpr unsigned kDue = kLevels + 1;
+
+  struct Node {
+    value_type value{};
+    tick_type deadline = 0;
+    std::uint32_t prev = kNil;
+    std::uint32_t next = kNil;
+    std::uint32_t generation = 0;
+    std::uint8_t level = 0;
+    std::uint8_t slot = 0;
+  };
+
+  struct List {
+    std::uint32_t head;
+    std::uint32_t tail;
+  };
+
+  static handle_type pack(std::uint32_t index, std::uint32_t generation) {
+    return static_cast<handle_type>(generation) << 32 | index;
+  }
+
+  bool resolve(handle_type handle, std::uint32_t &index) const {
+    index = static_cast<std::uint32_t>(handle);
+    return index < nodes_.size() && nodes_[index].prev != index &&
+           nodes_[index].generation == static_cast<std::uint32_t>(handle >> 32);
+  }
+
+  std::uint32_t allocate() {
+    if (free_ != kNil) {
+      std::uint32_t index = free_;
+      free_ = nodes_[index].next;
+      return index;
+    }
+    nodes_.push_back(Node());
+    return static_cast<std::uint32_t>(nodes_.size() - 1);
+  }
+
+  // A free node points prev at itself, which no linked node can do.
+  void release(std::uint32_t index) {
+    Node &node = nodes_[index];
+    ++node.generation;
+    node.value = value_type{};
+    node.prev = index;
+    node.next = free_;
+    free_ = index;
+  }
+
+  List &list_of(const Node &node) {
+    if (node.level == kOverflow) return overflow_;
+    if (node.level == kDue) return due_;
+    return slots_[node.level][node.slot];
+  }
+
+  void place(std::uint32_t index) {
+    Node &node = nodes_[index];
+    if (node.deadline <= now_) {
+      node.level = kDue;
+    } else {
+      tick_type delta = node.deadline - now_;
+      unsigned level = 0;
+      while (level < kLevels && (delta >> (kBits * (level + 1))) != 0) {
+        ++level;
+      }
+      node.level = static_cast<std::uint8_t>(level);
+      if (level < kLevels) {
+        node.slot = static_cast<std::uint8_t>(
+            (node.deadline >> (kBits * level)) & kMask);
+        ++counts_[level];
+      }
+    }
+    List &list = list_of(node);
+    node.prev = list.tail;
+    node.next = kNil;
+    if (list.tail != kNil) {
+      nodes_[list.tail].next = index;
+    } else {
+      list.head = index;
+    }
+    list.tail = index;
+  }
+
+  void unlink(std::uint32_t index) {
+    Node &node = nodes_[index];
+    List &list = list_of(node);
+    if (node.prev != kNil) {
+      nodes_[node.prev].next = node.next;
+    } else {
+      list.head = node.next;
+    }
+    if (node.next != kNil) {
+      nodes_[node.next].prev = node.prev;
+    } else {
+      list.tail = node.prev;
+    }
+    if (node.level < kLevels) --counts_[node.level];
+  }
+
+  // Redistributes the slot of `level` that just came round into lower levels.
+  void cascade(unsigned level) {
+    if (level == kLevels) {
+      redistribute(overflow_, kOverflow);
+      return;
+    }
+    tick_type slot = (now_ >> (kBits * level)) & kMask;
+    if (slot == 0) cascade(level + 1);
+    redistribute(slots_[level][slot], level);
+  }
+
+  void redistribute(List &list, unsigned level) {
+    std::uint32_t index = list.head;
+    list = List{kNil, kNil};
+    while (index != kNil) {
+      std::uint32_t next = nodes_[index].next;
+      if (level < kLevels) --counts_[level];
+      place(index);
+      index = next;
+    }
+  }
+
+  template <typename F>
+  size_type fire_due(F &expired) {
+    return fire_slot(due_, kDue, expired);
+  }
+
+  template <typename F>
+  size_type fire_slot(List &list, unsigned level, F &expired) {
+    size_type fired = 0;
+    while (list.head != kNil) {
+      std::uint32_t index = list.head;
+      Node &node = nodes_[index];
+      list.head = node.next;
+      if (list.head == kNil) {
+        list.tail = kNil;
+      } else {
+        nodes_[list.head].prev = kNil;
+      }
+      if (level < kLevels) --counts_[level];
+      --size_;
+      ++fired;
+      value_type value = std::move(node.value);
+      release(index);
+      expired(value);
+    }
+    return fired;
+  }
+
+  tick_type now_;
+  size_type size_;
+  std::uint32_t free_;
+  s21::Vector<Node> nodes_;
+  List slots_[kLevels][kSlots];
+  List overflow_;
+  List due_;
+  size_type counts_[kLevels];
+};
+
+// Map whose entries disappear once their deadline passes. Expiry runs in
+// expire(now); lookups never return an entry that expire() would drop.
+template <typename K, typename V>
+class TtlMap {
+ public:
+  using key_type = K;
+  using mapped_type = V;
+  using size_type = std::size_t;
+  using tick_type = typename TimerWheel<K>::tick_type;
+
+  explicit TtlMap(tick_type now = 0) : wheel_(now) {}
+
+  tick_type now() const noexcept { return wheel_.now(); }
+  size_type size() { return entries_.size(); }
+  bool empty() { return entries_.empty(); }
+
+  // Inserts or replaces the value and (re)arms the entry's deadline.
+  void insert_or_assign(const key_type &key, const mapped_type &value,
+                        tick_type deadline) {
+    auto it = entries_.find(key);
+    if (it != entries_.end()) {
+      Entry &entry = (*it).second;
+      entry.value = value;
+      entry.deadline = deadline;
+      wheel_.reschedule(entry.timer, deadline);
+    } else {
+      entries_.insert(
+          {key, Entry{value, deadline, wheel_.schedule(deadline, key)}});
+    }
+  }
+
+  // Extends or shortens the lifetime of an existing entry.
+  bool touch(const key_type &key, tick_type deadline) {
+    Entry *entry = live(key);
+    if (!entry) return false;
+    entry->deadline = deadline;
+    return wheel_.reschedule(entry->timer, deadline);
+  }
+
+  mapped_type *find(const key_type &key) {
+    Entry *entry = live(key);
+    return entry ? &entry->value : nullptr;
+  }
+
+  bool contains(const key_type &key) { return live(key) != nullptr; }
+
+  bool erase(const key_type &key) {
+    auto it = entries_.find(key);
+    if (it == entries_.end()) return false;
+    wheel_.cancel((*it).second.timer);
+    entries_.erase(it);
+    return true;
+  }
+
+  // Advances the clock and drops every expired entry. Returns the count.
+  size_type expire(tick_type now) {
+    return wheel_.advance(now, [this](const key_type &key) { remove(key); });
+  }
+
+ private:
+  struct Entry {
+    mapped_type value{};
+    tick_type deadline = 0;
+    typename TimerWheel<K>::handle_type timer = 0;
+  };
+
+  // The entry for key unless it is missing or past its deadline.
+  Entry *live(const key_type &key) {
+    auto it = entries_.find(key);
+    if (it == entries_.end()) return nullptr;
+    Entry &entry = (*it).second;
+    return entry.deadline > wheel_.now() ? &entry : nullptr;
+  }
+
+  void remove(const key_type &key) {
+    auto it = entries_.find(key);
+    if (it != entries_.end()) entries_.erase(it);
+  }
+
+  TimerWheel<key_type> wheel_;
+  s21::Map<key_type, Entry> entries_;
+};
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_TIMER_WHEEL_H
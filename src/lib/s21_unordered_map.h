@@ -0,0 +1,231 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_UNORDERED_MAP_H
+#define CPP2_S21_CONTAINERS_SRC_UNORDERED_MAP_H
+
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+#include "s21_hash_table.h"
+
+namespace s21 {
+template <typename Key, typename T>
+struct UnorderedMapKey {
+  const Key &operator()(const std::pair<const Key, T> &value) const {
+    return value.first;
+  }
+};
+
+// Hash map on the Swiss-table HashTable. Same interface as Map where the
+// ordering is not involved; a rehash moves elements, so it invalidates
+// iterators and references, and erase invalidates only the erased one.
+template <typename Key, typename T, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+class UnorderedMap {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using table_type =
+      HashTable<value_type, UnorderedMapKey<Key, T>, Hash, KeyEqual>;
+  using iterator = typename table_type::iterator;
+  using const_iterator = typename table_type::const_iterator;
+  using size_type = std::size_t;
+
+  UnorderedMap() : table_() {}
+
+  explicit UnorderedMap(size_type count, const Hash &hash = Hash(),
+                        const KeyEqual &equal = KeyEqual())
+      : table_(hash, equal) {
+    table_.reserve(count);
+  }
+
+  UnorderedMap(std::initializer_list<value_type> const &items)
+      : UnorderedMap(items.begin(), items.end()) {}
+
+  template <class InputIt>
+  UnorderedMap(InputIt first, InputIt last) : table_() {
+    insert(first, last);
+  }
+
+  UnorderedMap(const UnorderedMap &other) : table_(other.table_) {}
+  UnorderedMap(UnorderedMap &&other) noexcept
+      : table_(std::move(other.table_)) {}
+
+  UnorderedMap &operator=(const UnorderedMap &other) {
+    table_ = other.table_;
+    return *this;
+  }
+
+  UnorderedMap &operator=(UnorderedMap &&other) noexcept {
+    table_ = std::move(other.table_);
+    return *this;
+  }
+
+  ~UnorderedMap() {}
+
+  mapped_type &at(const key_type &key) { return at_found(find(key)); }
+  const mapped_type &at(const key_type &key) const {
+    return const_cast<UnorderedMap *>(this)->at(key);
+  }
+
+  // The heterogeneous overloads below take part only when both Hash and
+  // KeyEqual declare is_transparent.
+  template <class K, class H = Hash, class E = KeyEqual,
+            class = typename H::is_transparent,
+            class = typename E::is_transparent>
+  mapped_type &at(const K &key) {
+    return at_found(find(key));
+  }
+
+  mapped_type &operator[](const key_type &key) {
+    return try_emplace(key).first->second;
+  }
+
+  mapped_type &operator[](key_type &&key) {
+    return try_emplace(std::move(key)).first->second;
+  }
+
+  iterator begin() { return table_.begin(); }
+  iterator end() { return table_.end(); }
+  const_iterator begin() const { return table_.begin(); }
+  const_iterator end() const { return table_.end(); }
+
+  bool empty() const { return table_.empty(); }
+  size_type size() const { return table_.size(); }
+  size_type max_size() const { return table_.max_size(); }
+
+  size_type bucket_count() const { return table_.capacity(); }
+  float load_factor() const { return table_.load_factor(); }
+
+  // Makes room for count elements so inserting them does not rehash.
+  void reserve(size_type count) { table_.reserve(count); }
+
+  void clear() { table_.clear(); }
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return table_.try_emplace(value.first, value);
+  }
+
+  std::pair<iterator, bool> insert(value_type &&value) {
+    return table_.try_emplace(value.first, std::move(value));
+  }
+
+  std::pair<iterator, bool> insert(const key_type &key,
+                                   const mapped_type &obj) {
+    return try_emplace(key, obj);
+  }
+
+  template <class InputIt>
+  void insert(InputIt first, InputIt last) {
+    for (; first != last; ++first) insert(*first);
+  }
+
+  template <class M>
+  std::pair<iterator, bool> insert_or_assign(const key_type &key, M &&obj) {
+    auto result = try_emplace(key, std::forward<M>(obj));
+    if (!result.second) result.first->second = std::forward<M>(obj);
+    return result;
+  }
+
+  template <class M>
+  std::pair<iterator, bool> insert_or_assign(key_type &&key, M &&obj) {
+    auto result = try_emplace(std::move(key), std::forward<M>(obj));
+    if (!result.second) result.first->second = std::forward<M>(obj);
+    return result;
+  }
+
+  // Constructs the mapped value from args only if key is absent, after a
+  // single probe sequence.
+  template <class... Args>
+  std::pair<iterator, bool> try_emplace(const key_type &key, Args &&...args) {
+    return table_.try_emplace(
+        key, std::piecewise_construct, std::forward_as_tuple(key),
+        std::forward_as_tuple(std::forward<Args>(args)...));
+  }
+
+  template <class... Args>
+  std::pair<iterator, bool> try_emplace(key_type &&key, Args &&...args) {
+    return table_.try_emplace(
+        key, std::piecewise_construct, std::forward_as_tuple(std::move(key)),
+        std::forward_as_tuple(std::forward<Args>(args)...));
+  }
+
+  template <class... Args>
+  std::pair<iterator, bool> emplace(Args &&...args) {
+    return table_.emplace(std::forward<Args>(args)...);
+  }
+
+  template <class... Args>
+  void insert_many(Args &&...args) {
+    (insert(std::forward<Args>(args)), ...);
+  }
+
+  void erase(const_iterator pos) { table_.erase(pos); }
+  size_type erase(const key_type &key) { return table_.erase_key(key); }
+
+  void swap(UnorderedMap &other) { table_.swap(other.table_); }
+
+  // Moves over the elements whose keys are not here yet; the rest stay in
+  // other.
+  void merge(UnorderedMap &other) {
+    for (auto it = other.begin(); it != other.end();) {
+      auto current = it++;
+      if (table_.try_emplace(current->first, std::move(*current)).second) {
+        other.erase(current);
+      }
+    }
+  }
+
+  iterator find(const key_type &key) { return table_.find(key); }
+  const_iterator find(const key_type &key) const { return table_.find(key); }
+
+  template <class K, class H = Hash, class E = KeyEqual,
+            class = typename H::is_transparent,
+            class = typename E::is_transparent>
+  iterator find(const K &key) {
+    return table_.find(key);
+  }
+
+  template <class K, class H = Hash, class E = KeyEqual,
+            class = typename H::is_transparent,
+            class = typename E::is_transparent>
+  const_iterator find(const K &key) const {
+    return table_.find(key);
+  }
+
+  bool contains(const key_type &key) const { return find(key) != end(); }
+
+  template <class K, class H = Hash, class E = KeyEqual,
+            class = typename H::is_transparent,
+            class = typename E::is_transparent>
+  bool contains(const K &key) const {
+    return find(key) != end();
+  }
+
+  size_type count(const key_type &key) const { return contains(key); }
+
+  template <class K, class H = Hash, class E = KeyEqual,
+            class = typename H::is_transparent,
+            class = typename E::is_transparent>
+  size_type count(const K &key) const {
+    return contains(key);
+  }
+
+  hasher hash_function() const { return table_.hash_function(); }
+  key_equal key_eq() const { return table_.key_eq(); }
+
+ private:
+  mapped_type &at_found(iterator it) {
+    if (it == end()) throw std::out_of_range("Key does not exist!");
+    return it->second;
+  }
+
+  table_type table_;
+};
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_UNORDERED_MAP_H
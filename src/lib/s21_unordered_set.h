@@ -0,0 +1,150 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_UNORDERED_SET_H
+#define CPP2_S21_CONTAINERS_SRC_UNORDERED_SET_H
+
+#include <functional>
+#include <initializer_list>
+#include <utility>
+
+#include "s21_hash_table.h"
+
+namespace s21 {
+struct UnorderedSetKey {
+  template <typename Key>
+  const Key &operator()(const Key &value) const {
+    return value;
+  }
+};
+
+// Hash set on the Swiss-table HashTable with the Set interface minus the
+// ordered queries. Elements are immutable, so iterator is a const_iterator.
+template <typename Key, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+class UnorderedSet {
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using table_type = HashTable<value_type, UnorderedSetKey, Hash, KeyEqual>;
+  using iterator = typename table_type::const_iterator;
+  using const_iterator = iterator;
+  using size_type = std::size_t;
+
+  UnorderedSet() : table_() {}
+
+  explicit UnorderedSet(size_type count, const Hash &hash = Hash(),
+                        const KeyEqual &equal = KeyEqual())
+      : table_(hash, equal) {
+    table_.reserve(count);
+  }
+
+  UnorderedSet(std::initializer_list<value_type> const &items)
+      : UnorderedSet(items.begin(), items.end()) {}
+
+  template <class InputIt>
+  UnorderedSet(InputIt first, InputIt last) : table_() {
+    insert(first, last);
+  }
+
+  UnorderedSet(const UnorderedSet &other) : table_(other.table_) {}
+  UnorderedSet(UnorderedSet &&other) noexcept
+      : table_(std::move(other.table_)) {}
+
+  UnorderedSet &operator=(const UnorderedSet &other) {
+    table_ = other.table_;
+    return *this;
+  }
+
+  UnorderedSet &operator=(UnorderedSet &&other) noexcept {
+    table_ = std::move(other.table_);
+    return *this;
+  }
+
+  ~UnorderedSet() {}
+
+  iterator begin() const { return table_.begin(); }
+  iterator end() const { return table_.end(); }
+
+  bool empty() const { return table_.empty(); }
+  size_type size() const { return table_.size(); }
+  size_type max_size() const { return table_.max_size(); }
+
+  size_type bucket_count() const { return table_.capacity(); }
+  float load_factor() const { return table_.load_factor(); }
+
+  void reserve(size_type count) { table_.reserve(count); }
+
+  void clear() { table_.clear(); }
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return table_.try_emplace(value, value);
+  }
+
+  std::pair<iterator, bool> insert(value_type &&value) {
+    return table_.try_emplace(value, std::move(value));
+  }
+
+  template <class InputIt>
+  void insert(InputIt first, InputIt last) {
+    for (; first != last; ++first) insert(*first);
+  }
+
+  template <class... Args>
+  std::pair<iterator, bool> emplace(Args &&...args) {
+    return table_.emplace(std::forward<Args>(args)...);
+  }
+
+  template <class... Args>
+  void insert_many(Args &&...args) {
+    (insert(std::forward<Args>(args)), ...);
+  }
+
+  void erase(iterator pos) { table_.erase(pos); }
+  size_type erase(const key_type &key) { return table_.erase_key(key); }
+
+  void swap(UnorderedSet &other) { table_.swap(other.table_); }
+
+  // Moves over the elements not here yet; the rest stay in other.
+  void merge(UnorderedSet &other) {
+    for (auto it = other.begin(); it != other.end();) {
+      auto current = it++;
+      if (table_.try_emplace(*current, *current).second) other.erase(current);
+    }
+  }
+
+  iterator find(const key_type &key) const { return table_.find(key); }
+
+  template <class K, class H = Hash, class E = KeyEqual,
+            class = typename H::is_transparent,
+            class = typename E::is_transparent>
+  iterator find(const K &key) const {
+    return table_.find(key);
+  }
+
+  bool contains(const key_type &key) const { return find(key) != end(); }
+
+  template <class K, class H = Hash, class E = KeyEqual,
+            class = typename H::is_transparent,
+            class = typename E::is_transparent>
+  bool contains(const K &key) const {
+    return find(key) != end();
+  }
+
+  size_type count(const key_type &key) const { return contains(key); }
+
+  template <class K, class H = Hash, class E = KeyEqual,
+            class = typename H::is_transparent,
+            class = typename E::is_transparent>
+  size_type count(const K &key) const {
+    return contains(key);
+  }
+
+  hasher hash_function() const { return table_.hash_function(); }
+  key_equal key_eq() const { return table_.key_eq(); }
+
+ private:
+  table_type table_;
+};
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_UNORDERED_SET_H
@@ -3,6 +3,8 @@
 
 #include <cmath>
 #include <initializer_list>
+#include <stdexcept>
+#include <utility>
 
 namespace s21 {
 template <typename T>
@@ -149,7 +151,7 @@ class Vector {
     if (size_ == capacity_) {
       allocate(size_ + size_ + 1);
     }
-    data_[size_++] = v;
+    data_[size_++] = std::move(v);
   };
 
   void pop_back() noexcept {
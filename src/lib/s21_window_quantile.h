@@ -0,0 +1,103 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_WINDOW_QUANTILE_H
+#define CPP2_S21_CONTAINERS_SRC_WINDOW_QUANTILE_H
+
+#include <cmath>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+
+#include "s21_multiset.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// Quantiles over the last capacity() samples. The window lives twice: in an
+// order-statistic Multiset for queries and in a ring of arrival order that
+// says which sample to evict. push and any quantile query are O(log n).
+template <typename T, typename Compare = std::less<T>>
+class WindowQuantile {
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+
+  explicit WindowQuantile(size_type capacity,
+                          const Compare &comp = Compare())
+      : ring_(capacity ? capacity : 1), head_(0), size_(0), sorted_(comp) {}
+
+  size_type size() const noexcept { return size_; }
+  size_type capacity() const noexcept { return ring_.size(); }
+  bool empty() const noexcept { return size_ == 0; }
+
+  void push(const value_type &sample) {
+    if (size_ == ring_.size()) {
+      sorted_.erase(sorted_.find(ring_[head_]));
+    } else {
+      ++size_;
+    }
+    ring_[head_] = sample;
+    sorted_.insert(sample);
+    head_ = head_ + 1 == ring_.size() ? 0 : head_ + 1;
+  }
+
+  // Only the newest capacity() samples of a batch can survive it, so older
+  // ones are never inserted. A forward range is counted first and skipped
+  // into; a single-pass one is read once into a ring of the newest samples.
+  template <typename InputIt>
+  void push_many(InputIt first, InputIt last) {
+    using Category = typename std::iterator_traits<InputIt>::iterator_category;
+    if constexpr (std::is_base_of_v<std::forward_iterator_tag, Category>) {
+      size_type count = 0;
+      for (InputIt it = first; it != last; ++it) ++count;
+      if (count >= ring_.size()) {
+        clear();
+        for (; count > ring_.size(); --count) ++first;
+      }
+      for (; first != last; ++first) push(*first);
+    } else {
+      s21::Vector<value_type> newest(ring_.size());
+      size_type count = 0;
+      for (; first != last; ++first) newest[count++ % newest.size()] = *first;
+      size_type start = 0;
+      if (count >= newest.size()) {
+        clear();
+        start = count - newest.size();
+      }
+      for (size_type i = start; i < count; ++i) {
+        push(newest[i % newest.size()]);
+      }
+    }
+  }
+
+  // Nearest-rank quantile: the smallest sample with at least q of the
+  // window at or below it. q must lie in [0, 1].
+  const value_type &quantile(double q) {
+    if (empty()) throw std::out_of_range("WindowQuantile is empty");
+    if (!(q >= 0.0 && q <= 1.0)) {
+      throw std::invalid_argument("Quantile must be within [0, 1]");
+    }
+    size_type rank = static_cast<size_type>(std::ceil(q * size_));
+    return sorted_.select(rank ? rank - 1 : 0);
+  }
+
+  const value_type &median() { return quantile(0.5); }
+  const value_type &min() { return quantile(0.0); }
+  const value_type &max() { return quantile(1.0); }
+
+  // Number of samples in the window ordered before value.
+  size_type rank(const value_type &value) { return sorted_.rank(value); }
+
+  void clear() {
+    sorted_.clear();
+    head_ = 0;
+    size_ = 0;
+  }
+
+ private:
+  s21::Vector<value_type> ring_;
+  size_type head_;
+  size_type size_;
+  s21::Multiset<value_type, Compare> sorted_;
+};
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_WINDOW_QUANTILE_H
@@ -0,0 +1,140 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_WORK_STEALING_DEQUE_H
+#define CPP2_S21_CONTAINERS_SRC_WORK_STEALING_DEQUE_H
+
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+
+#include "s21_vector.h"
+
+namespace s21 {
+// Chase-Lev deque (Le et al., "Correct and Efficient Work-Stealing for Weak
+// Memory Models"). The owner pushes and pops at the bottom, any thread may
+// steal from the top. Replaced buffers are kept until destruction because a
+// thief may still be reading from them.
+template <typename T>
+class WorkStealingDeque {
+  static_assert(std::is_trivially_copyable<T>::value,
+                "WorkStealingDeque elements are read speculatively and must "
+                "be trivially copyable");
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+
+  explicit WorkStealingDeque(size_type capacity = 64)
+      : top_(0), bottom_(0), buffer_(new Buffer(round_up(capacity))) {}
+
+  WorkStealingDeque(const WorkStealingDeque &) = delete;
+  WorkStealingDeque &operator=(const WorkStealingDeque &) = delete;
+
+  ~WorkStealingDeque() {
+    delete buffer_.load(std::memory_order_relaxed);
+    for (Buffer *old : retired_) delete old;
+  }
+
+  // ---------------- Owner ---------------------
+
+  void push(const_reference value) {
+    std::int64_t bottom = bottom_.load(std::memory_order_relaxed);
+    std::int64_t top = top_.load(std::memory_order_acquire);
+    Buffer *buffer = buffer_.load(std::memory_order_relaxed);
+    if (bottom - top > buffer->mask) buffer = grow(buffer, top, bottom);
+    buffer->put(bottom, value);
+    bottom_.store(bottom + 1, std::memory_order_release);
+  }
+
+  bool pop(reference out) {
+    std::int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+    Buffer *buffer = buffer_.load(std::memory_order_relaxed);
+    bottom_.store(bottom, std::memory_order_seq_cst);
+    std::int64_t top = top_.load(std::memory_order_seq_cst);
+    if (top > bottom) {
+      bottom_.store(bottom + 1, std::memory_order_relaxed);
+      return false;
+    }
+    out = buffer->get(bottom);
+    if (top == bottom) {
+      // Last element: race the thieves for it.
+      bool won = top_.compare_exchange_strong(top, top + 1,
+                                              std::memory_order_seq_cst,
+                                              std::memory_order_relaxed);
+      bottom_.store(bottom + 1, std::memory_order_relaxed);
+      return won;
+    }
+    return true;
+  }
+
+  // ---------------- Thieves ---------------------
+
+  // Returns false when the deque is empty or another thread won the race.
+  bool steal(reference out) {
+    std::int64_t top = top_.load(std::memory_order_seq_cst);
+    std::int64_t bottom = bottom_.load(std::memory_order_seq_cst);
+    if (top >= bottom) return false;
+    Buffer *buffer = buffer_.load(std::memory_order_acquire);
+    value_type value = buffer->get(top);
+    if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                      std::memory_order_relaxed)) {
+      return false;
+    }
+    out = value;
+    return true;
+  }
+
+  // ---------------- Capacity ---------------------
+
+  size_type size() const noexcept {
+    std::int64_t bottom = bottom_.load(std::memory_order_relaxed);
+    std::int64_t top = top_.load(std::memory_order_relaxed);
+    return bottom > top ? static_cast<size_type>(bottom - top) : 0;
+  }
+
+  bool empty() const noexcept { return size() == 0; }
+
+  size_type capacity() const noexcept {
+    return buffer_.load(std::memory_order_relaxed)->mask + 1;
+  }
+
+ private:
+  struct Buffer {
+    explicit Buffer(size_type size)
+        : mask(static_cast<std::int64_t>(size) - 1),
+          cells(new std::atomic<value_type>[size]) {}
+    ~Buffer() { delete[] cells; }
+
+    value_type get(std::int64_t i) const {
+      return cells[i & mask].load(std::memory_order_relaxed);
+    }
+    void put(std::int64_t i, const_reference value) {
+      cells[i & mask].store(value, std::memory_order_relaxed);
+    }
+
+    const std::int64_t mask;
+    std::atomic<value_type> *cells;
+  };
+
+  static size_type round_up(size_type capacity) {
+    size_type result = 2;
+    while (result < capacity) result <<= 1;
+    return result;
+  }
+
+  Buffer *grow(Buffer *old, std::int64_t top, std::int64_t bottom) {
+    Buffer *bigger = new Buffer(2 * static_cast<size_type>(old->mask + 1));
+    for (std::int64_t i = top; i < bottom; ++i) bigger->put(i, old->get(i));
+    retired_.push_back(old);
+    buffer_.store(bigger, std::memory_order_release);
+    return bigger;
+  }
+
+  alignas(64) std::atomic<std::int64_t> top_;
+  alignas(64) std::atomic<std::int64_t> bottom_;
+  std::atomic<Buffer *> buffer_;
+  s21::Vector<Buffer *> retired_;
+};
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_WORK_STEALING_DEQUE_H
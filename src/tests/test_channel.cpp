@@ -0,0 +1,169 @@
+#include <gtest/gtest.h>
+
+#if defined(__cpp_impl_coroutine)
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+
+#include "../lib/s21_channel.h"
+
+namespace {
+s21::Detached produce(s21::Channel<int> &channel, int from, int to,
+                      bool close) {
+  for (int i = from; i < to; ++i) co_await channel.push(i);
+  if (close) channel.close();
+}
+
+s21::Detached consume(s21::Channel<int> &channel, long long &sum, int &count) {
+  while (auto value = co_await channel.pop()) {
+    sum += *value;
+    ++count;
+  }
+}
+
+s21::Detached pop_once(s21::Channel<std::string> &channel,
+                       std::optional<std::string> &out, bool &done) {
+  out = co_await channel.pop();
+  done = true;
+}
+
+s21::Detached push_once(s21::Channel<std::string> &channel, std::string value,
+                        bool &delivered, bool &done) {
+  delivered = co_await channel.push(std::move(value));
+  done = true;
+}
+}  // namespace
+
+TEST(ChannelTest, ProducerConsumerOnRunLoop) {
+  s21::RunLoop loop;
+  s21::Channel<int> channel(loop, 4);
+  long long sum = 0;
+  int count = 0;
+  consume(channel, sum, count);
+  produce(channel, 0, 100, true);
+  loop.run();
+  EXPECT_EQ(count, 100);
+  EXPECT_EQ(sum, 4950);
+}
+
+TEST(ChannelTest, PopSuspendsUntilPush) {
+  s21::RunLoop loop;
+  s21::Channel<std::string> channel(loop);
+  std::optional<std::string> out;
+  bool done = false;
+  pop_once(channel, out, done);
+  EXPECT_FALSE(done);
+  EXPECT_TRUE(channel.try_push("hello"));
+  EXPECT_FALSE(done);
+  EXPECT_EQ(loop.run(), 1);
+  EXPECT_TRUE(done);
+  EXPECT_EQ(*out, "hello");
+}
+
+TEST(ChannelTest, FullChannelSuspendsPusher) {
+  s21::RunLoop loop;
+  s21::Channel<std::string> channel(loop, 1);
+  bool first = false, second = false, first_done = false, second_done = false;
+  push_once(channel, "a", first, first_done);
+  push_once(channel, "b", second, second_done);
+  EXPECT_TRUE(first_done);
+  EXPECT_FALSE(second_done);
+  EXPECT_EQ(channel.size(), 1);
+  EXPECT_EQ(*channel.try_pop(), "a");
+  loop.run();
+  EXPECT_TRUE(second_done);
+  EXPECT_TRUE(second);
+  EXPECT_EQ(*channel.try_pop(), "b");
+  EXPECT_FALSE(channel.try_pop().has_value());
+}
+
+TEST(ChannelTest, CloseWakesWaiters) {
+  s21::RunLoop loop;
+  s21::Channel<std::string> channel(loop);
+  std::optional<std::string> out("unchanged");
+  bool done = false;
+  pop_once(channel, out, done);
+  channel.close();
+  loop.run();
+  EXPECT_TRUE(done);
+  EXPECT_FALSE(out.has_value());
+  EXPECT_FALSE(channel.try_push("late"));
+  bool delivered = true, pushed = false;
+  push_once(channel, "late", delivered, pushed);
+  EXPECT_TRUE(pushed);
+  EXPECT_FALSE(delivered);
+}
+
+TEST(ChannelTest, ThreadPoolSchedulesPastCapacityFromWorkers) {
+  const int kChildren = 1000;
+  std::atomic<int> resumed{0};
+  {
+    s21::ThreadPoolExecutor pool(1, 4);
+    auto child = [](s21::Executor &executor,
+                    std::atomic<int> &count) -> s21::Detached {
+      co_await s21::ResumeOn{executor};
+      ++count;
+    };
+    auto spawner = [child](s21::Executor &executor, std::atomic<int> &count,
+                           int children) -> s21::Detached {
+      co_await s21::ResumeOn{executor};
+      for (int i = 0; i < children; ++i) child(executor, count);
+    };
+    spawner(pool, resumed, kChildren);
+    while (resumed.load() < kChildren) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+  }
+  EXPECT_EQ(resumed.load(), kChildren);
+}
+
+TEST(ChannelTest, ThreadPoolExecutor) {
+  const int kProducers = 4;
+  const int kPerProducer = 2000;
+  long long sum = 0;
+  int count = 0;
+  {
+    s21::ThreadPoolExecutor pool(3);
+    s21::Channel<int> channel(pool, 8);
+    s21::Channel<int> done(pool);
+    std::atomic<int> finished{0};
+    auto producer = [](s21::Channel<int> &out, s21::Channel<int> &signal,
+                       s21::Executor &executor, int from,
+                       int to) -> s21::Detached {
+      co_await s21::ResumeOn{executor};
+      for (int i = from; i < to; ++i) co_await out.push(i);
+      co_await signal.push(1);
+    };
+    for (int p = 0; p < kProducers; ++p) {
+      producer(channel, done, pool, p * kPerProducer, (p + 1) * kPerProducer);
+    }
+    auto consumer = [](s21::Channel<int> &in, s21::Executor &executor,
+                       long long &total, int &n,
+                       std::atomic<int> &flag) -> s21::Detached {
+      co_await s21::ResumeOn{executor};
+      while (auto value = co_await in.pop()) {
+        total += *value;
+        ++n;
+      }
+      flag = 1;
+    };
+    consumer(channel, pool, sum, count, finished);
+    auto closer = [](s21::Channel<int> &signal, s21::Channel<int> &out,
+                     s21::Executor &executor) -> s21::Detached {
+      co_await s21::ResumeOn{executor};
+      for (int p = 0; p < kProducers; ++p) co_await signal.pop();
+      out.close();
+    };
+    closer(done, channel, pool);
+    while (!finished.load()) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+  }
+  long long n = static_cast<long long>(kProducers) * kPerProducer;
+  EXPECT_EQ(count, n);
+  EXPECT_EQ(sum, n * (n - 1) / 2);
+}
+
+#endif
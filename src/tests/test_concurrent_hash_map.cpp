@@ -0,0 +1,148 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <map>
+#include <random>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "../lib/s21_concurrent_hash_map.h"
+
+namespace {
+// Every key lands in one chain, so replacing and unlinking mid-chain nodes
+// and splitting a long chain on resize are exercised.
+struct Collide {
+  std::size_t operator()(int) const { return 0; }
+};
+}  // namespace
+
+TEST(ConcurrentHashMapTest, BasicOperations) {
+  s21::ConcurrentHashMap<int, std::string> map;
+  EXPECT_TRUE(map.insert(1, "a"));
+  EXPECT_FALSE(map.insert(1, "b"));
+  EXPECT_FALSE(map.insert_or_assign(1, "c"));
+  EXPECT_TRUE(map.insert_or_assign(2, "d"));
+  std::string value;
+  EXPECT_TRUE(map.find(1, value));
+  EXPECT_EQ(value, "c");
+  EXPECT_FALSE(map.find(3, value));
+  EXPECT_TRUE(map.contains(2));
+  EXPECT_EQ(map.size(), 2);
+  EXPECT_TRUE(map.update(2, [](std::string &s) { s += "!"; }));
+  EXPECT_FALSE(map.update(3, [](std::string &) {}));
+  EXPECT_TRUE(map.visit(2, [](const std::string &s) { EXPECT_EQ(s, "d!"); }));
+  int calls = 0;
+  auto make = [&calls](int key) {
+    ++calls;
+    return std::to_string(key);
+  };
+  EXPECT_EQ(map.compute_if_absent(7, make), "7");
+  EXPECT_EQ(map.compute_if_absent(7, make), "7");
+  EXPECT_EQ(calls, 1);
+  EXPECT_TRUE(map.erase(1));
+  EXPECT_FALSE(map.erase(1));
+  EXPECT_EQ(map.size(), 2);
+}
+
+TEST(ConcurrentHashMapTest, MatchesModelThroughGrowth) {
+  s21::ConcurrentHashMap<int, int> map;
+  std::unordered_map<int, int> model;
+  std::mt19937 rng(49);
+  for (int step = 0; step < 100000; ++step) {
+    int key = static_cast<int>(rng() % 20000);
+    if (rng() % 3) {
+      map.insert_or_assign(key, step);
+      model[key] = step;
+    } else {
+      ASSERT_EQ(map.erase(key), model.erase(key) == 1);
+    }
+  }
+  EXPECT_EQ(map.size(), model.size());
+  EXPECT_GE(map.bucket_count() * 3 / 4, model.size() / 2);
+  std::map<int, int> seen;
+  map.for_each([&seen](int key, int value) { seen[key] = value; });
+  EXPECT_EQ(seen, (std::map<int, int>(model.begin(), model.end())));
+}
+
+TEST(ConcurrentHashMapTest, CollidingKeysSplitAndErase) {
+  s21::ConcurrentHashMap<int, int, Collide> map;
+  for (int i = 0; i < 300; ++i) map.insert(i, i);
+  for (int i = 0; i < 300; i += 3) EXPECT_TRUE(map.erase(i));
+  for (int i = 1; i < 300; i += 3) map.insert_or_assign(i, -i);
+  for (int i = 0; i < 300; ++i) {
+    int value = 0;
+    EXPECT_EQ(map.find(i, value), i % 3 != 0);
+    if (i % 3 == 1) {
+      EXPECT_EQ(value, -i);
+    }
+  }
+  EXPECT_EQ(map.size(), 200);
+}
+
+TEST(ConcurrentHashMapTest, ReserveFinishesResize) {
+  s21::ConcurrentHashMap<int, int> map;
+  map.reserve(10000);
+  std::size_t buckets = map.bucket_count();
+  EXPECT_GE(buckets * 3 / 4, 10000);
+  for (int i = 0; i < 10000; ++i) map.insert(i, i);
+  EXPECT_EQ(map.bucket_count(), buckets);
+}
+
+TEST(ConcurrentHashMapTest, ReadersSeeStableKeysDuringResize) {
+  s21::ConcurrentHashMap<int, int> map;
+  const int kStable = 1000;
+  for (int i = 0; i < kStable; ++i) map.insert(-i - 1, i);
+  std::atomic<bool> done{false};
+  std::atomic<int> misses{0};
+  std::vector<std::thread> readers;
+  for (int t = 0; t < 3; ++t) {
+    readers.emplace_back([&map, &done, &misses, t] {
+      while (!done.load()) {
+        for (int i = t; i < kStable; i += 7) {
+          int value = -1;
+          if (!map.find(-i - 1, value) || value != i) misses.fetch_add(1);
+        }
+      }
+    });
+  }
+  std::thread writer([&map] {
+    for (int i = 0; i < 30000; ++i) {
+      map.insert(i, i);
+      if (i % 4 == 0) map.erase(i / 2);
+    }
+  });
+  writer.join();
+  done.store(true);
+  for (std::thread &reader : readers) reader.join();
+  EXPECT_EQ(misses.load(), 0);
+  EXPECT_GE(map.bucket_count(), 16384);
+}
+
+TEST(ConcurrentHashMapTest, ConcurrentWritersKeepCountsAndUpdates) {
+  s21::ConcurrentHashMap<int, long> map;
+  const int kThreads = 4;
+  const int kRounds = 5000;
+  std::atomic<int> inserted{0};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&map, &inserted, t] {
+      for (int i = 0; i < kRounds; ++i) {
+        int key = t * kRounds + i;
+        if (map.insert(key, i)) inserted.fetch_add(1);
+        if (i % 2 && map.erase(key)) inserted.fetch_sub(1);
+        map.compute_if_absent(-1 - i % 32, [](int) { return 0L; });
+        map.update(-1 - i % 32, [](long &value) { ++value; });
+      }
+    });
+  }
+  for (std::thread &thread : threads) thread.join();
+  long total = 0;
+  map.for_each([&total](int key, long value) {
+    if (key < 0) total += value;
+  });
+  EXPECT_EQ(total, static_cast<long>(kThreads) * kRounds);
+  EXPECT_EQ(map.size(), static_cast<std::size_t>(inserted.load()) + 32);
+  EXPECT_EQ(map.size(), kThreads * kRounds / 2 + 32);
+}
@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <map>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../lib/s21_concurrent_map.h"
+
+TEST(ConcurrentMapTest, BasicOperations) {
+  s21::ConcurrentMap<int, std::string> map(5);
+  EXPECT_EQ(map.shard_count(), 8);
+  EXPECT_TRUE(map.insert(1, "a"));
+  EXPECT_FALSE(map.insert(1, "b"));
+  EXPECT_FALSE(map.insert_or_assign(1, "c"));
+  EXPECT_TRUE(map.insert_or_assign(2, "d"));
+  std::string value;
+  EXPECT_TRUE(map.find(1, value));
+  EXPECT_EQ(value, "c");
+  EXPECT_FALSE(map.find(3, value));
+  EXPECT_TRUE(map.contains(2));
+  EXPECT_EQ(map.size(), 2);
+  EXPECT_TRUE(map.update(2, [](std::string &s) { s += "!"; }));
+  EXPECT_FALSE(map.update(3, [](std::string &) {}));
+  EXPECT_TRUE(map.visit(2, [](const std::string &s) { EXPECT_EQ(s, "d!"); }));
+  EXPECT_TRUE(map.erase(1));
+  EXPECT_FALSE(map.erase(1));
+  EXPECT_EQ(map.size(), 1);
+  map.clear();
+  EXPECT_TRUE(map.empty());
+}
+
+TEST(ConcurrentMapTest, ComputeIfAbsentRunsOnce) {
+  s21::ConcurrentMap<int, int> map;
+  int calls = 0;
+  auto make = [&calls](int key) {
+    ++calls;
+    return key * 10;
+  };
+  EXPECT_EQ(map.compute_if_absent(4, make), 40);
+  EXPECT_EQ(map.compute_if_absent(4, make), 40);
+  EXPECT_EQ(calls, 1);
+}
+
+TEST(ConcurrentMapTest, OrderedIterationMergesShards) {
+  s21::ConcurrentMap<int, int> map(16);
+  std::map<int, int> model;
+  std::mt19937 rng(46);
+  for (int i = 0; i < 5000; ++i) {
+    int key = static_cast<int>(rng() % 100000);
+    map.insert_or_assign(key, i);
+    model[key] = i;
+  }
+  std::vector<std::pair<int, int>> seen;
+  map.for_each([&seen](const std::pair<const int, int> &item) {
+    seen.emplace_back(item.first, item.second);
+  });
+  EXPECT_EQ(seen, (std::vector<std::pair<int, int>>(model.begin(),
+                                                    model.end())));
+  seen.clear();
+  map.for_each_range(20000, 30000, [&seen](const auto &item) {
+    seen.emplace_back(item.first, item.second);
+  });
+  EXPECT_EQ(seen, (std::vector<std::pair<int, int>>(
+                      model.lower_bound(20000), model.lower_bound(30000))));
+}
+
+TEST(ConcurrentMapTest, ConcurrentUpdatesAreAtomic) {
+  s21::ConcurrentMap<int, long> map(4);
+  const int kThreads = 4;
+  const int kRounds = 5000;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&map, t] {
+      for (int i = 0; i < kRounds; ++i) {
+        int key = i % 64;
+        map.compute_if_absent(key, [](int) { return 0L; });
+        map.update(key, [](long &value) { ++value; });
+        long value = 0;
+        map.find((key + t) % 64, value);
+        if (i % 500 == 0) {
+          long total = 0;
+          map.for_each([&total](const auto &item) { total += item.second; });
+        }
+      }
+    });
+  }
+  for (std::thread &thread : threads) thread.join();
+  long total = 0;
+  map.for_each([&total](const auto &item) { total += item.second; });
+  EXPECT_EQ(total, static_cast<long>(kThreads) * kRounds);
+  EXPECT_EQ(map.size(), 64);
+}
+
+TEST(ConcurrentMapTest, ConcurrentInsertEraseKeepsSize) {
+  s21::ConcurrentMap<int, int> map;
+  std::atomic<int> inserted{0};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&map, &inserted, t] {
+      for (int i = 0; i < 2000; ++i) {
+        int key = t * 2000 + i;
+        if (map.insert(key, i)) inserted.fetch_add(1);
+        if (i % 2 && map.erase(key)) inserted.fetch_sub(1);
+      }
+    });
+  }
+  for (std::thread &thread : threads) thread.join();
+  EXPECT_EQ(map.size(), static_cast<std::size_t>(inserted.load()));
+  EXPECT_EQ(map.size(), 4000);
+}
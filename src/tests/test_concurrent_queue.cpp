@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../lib/s21_concurrent_queue.h"
+
+TEST(ConcurrentQueueTest, PushPop) {
+  s21::ConcurrentQueue<int> a;
+  EXPECT_TRUE(a.empty());
+  EXPECT_TRUE(a.push(1));
+  EXPECT_TRUE(a.push(2));
+  EXPECT_EQ(a.size(), 2);
+  int value = 0;
+  EXPECT_TRUE(a.pop(value));
+  EXPECT_EQ(value, 1);
+  EXPECT_TRUE(a.try_pop(value));
+  EXPECT_EQ(value, 2);
+  EXPECT_FALSE(a.try_pop(value));
+}
+
+TEST(ConcurrentQueueTest, ZeroCapacityThrows) {
+  EXPECT_ANY_THROW(s21::ConcurrentQueue<int>(0));
+}
+
+TEST(ConcurrentQueueTest, BoundedTryPush) {
+  s21::ConcurrentQueue<int> a(2);
+  EXPECT_TRUE(a.try_push(1));
+  EXPECT_TRUE(a.try_push(2));
+  EXPECT_FALSE(a.try_push(3));
+  EXPECT_FALSE(a.push_for(3, std::chrono::milliseconds(5)));
+  EXPECT_EQ(a.size(), 2);
+}
+
+TEST(ConcurrentQueueTest, TimedPopExpires) {
+  s21::ConcurrentQueue<int> a;
+  int value = 0;
+  EXPECT_FALSE(a.pop_for(value, std::chrono::milliseconds(5)));
+  std::vector<int> out(4);
+  EXPECT_EQ(a.pop_bulk_for(out.begin(), 4, std::chrono::milliseconds(5)), 0);
+}
+
+TEST(ConcurrentQueueTest, MovesElements) {
+  s21::ConcurrentQueue<std::string> a;
+  std::string big(1000, 'x');
+  a.push(std::move(big));
+  std::string out;
+  a.pop(out);
+  EXPECT_EQ(out.size(), 1000);
+}
+
+TEST(ConcurrentQueueTest, PopBulkDrainsInOrder) {
+  s21::ConcurrentQueue<int> a;
+  std::vector<int> in{1, 2, 3, 4, 5};
+  EXPECT_EQ(a.push_bulk(in.begin(), in.end()), 5);
+  std::vector<int> out(3);
+  EXPECT_EQ(a.pop_bulk(out.begin(), 3), 3);
+  EXPECT_EQ(out, (std::vector<int>{1, 2, 3}));
+  EXPECT_EQ(a.try_pop_bulk(out.begin(), 3), 2);
+  EXPECT_EQ(out[0], 4);
+  EXPECT_EQ(out[1], 5);
+}
+
+TEST(ConcurrentQueueTest, CloseReleasesConsumers) {
+  s21::ConcurrentQueue<int> a;
+  std::thread consumer([&a] {
+    int value = 0;
+    EXPECT_FALSE(a.pop(value));
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  a.close();
+  consumer.join();
+  EXPECT_TRUE(a.closed());
+  EXPECT_FALSE(a.push(1));
+}
+
+TEST(ConcurrentQueueTest, CloseKeepsQueuedElements) {
+  s21::ConcurrentQueue<int> a;
+  a.push(7);
+  a.close();
+  int value = 0;
+  EXPECT_TRUE(a.pop(value));
+  EXPECT_EQ(value, 7);
+  EXPECT_FALSE(a.pop(value));
+}
+
+TEST(ConcurrentQueueTest, BackpressureBlocksProducer) {
+  const int kCount = 20000;
+  s21::ConcurrentQueue<int> a(4);
+  std::thread producer([&a] {
+    for (int i = 0; i < kCount; ++i) a.push(i);
+    a.close();
+  });
+  std::vector<int> out(8);
+  long long sum = 0;
+  int received = 0;
+  std::size_t count = 0;
+  while ((count = a.pop_bulk(out.begin(), out.size())) != 0) {
+    EXPECT_LE(count, 4);
+    for (std::size_t i = 0; i < count; ++i) sum += out[i];
+    received += static_cast<int>(count);
+  }
+  producer.join();
+  EXPECT_EQ(received, kCount);
+  EXPECT_EQ(sum, static_cast<long long>(kCount) * (kCount - 1) / 2);
+}
+
+TEST(ConcurrentQueueTest, ManyProducersManyConsumers) {
+  const int kThreads = 4;
+  const int kPerThread = 5000;
+  s21::ConcurrentQueue<int> a(64);
+  std::vector<std::thread> producers;
+  std::vector<std::thread> consumers;
+  std::vector<long long> sums(kThreads, 0);
+  for (int t = 0; t < kThreads; ++t) {
+    producers.emplace_back([&a, t] {
+      for (int i = 1; i <= kPerThread; ++i) a.push(i + t * kPerThread);
+    });
+    consumers.emplace_back([&a, &sums, t] {
+      int value = 0;
+      while (a.pop(value)) sums[t] += value;
+    });
+  }
+  for (auto &producer : producers) producer.join();
+  a.close();
+  for (auto &consumer : consumers) consumer.join();
+  long long total = 0;
+  for (long long sum : sums) total += sum;
+  long long n = static_cast<long long>(kThreads) * kPerThread;
+  EXPECT_EQ(total, n * (n + 1) / 2);
+}
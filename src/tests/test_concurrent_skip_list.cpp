@@ -0,0 +1,130 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <random>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../lib/s21_concurrent_skip_list.h"
+
+TEST(ConcurrentSkipListTest, SetBasicOperations) {
+  s21::ConcurrentSkipListSet<int> set;
+  EXPECT_TRUE(set.empty());
+  EXPECT_TRUE(set.insert(5));
+  EXPECT_TRUE(set.insert(1));
+  EXPECT_TRUE(set.insert(3));
+  EXPECT_FALSE(set.insert(3));
+  EXPECT_EQ(set.size(), 3);
+  EXPECT_TRUE(set.contains(1));
+  EXPECT_FALSE(set.contains(2));
+  EXPECT_EQ(*set.find(5), 5);
+  EXPECT_EQ(set.find(4), set.end());
+  EXPECT_EQ(*set.lower_bound(2), 3);
+  EXPECT_EQ(set.lower_bound(6), set.end());
+  std::vector<int> values(set.begin(), set.end());
+  EXPECT_EQ(values, (std::vector<int>{1, 3, 5}));
+  EXPECT_TRUE(set.erase(3));
+  EXPECT_FALSE(set.erase(3));
+  EXPECT_EQ(*set.lower_bound(2), 5);
+  EXPECT_EQ(set.size(), 2);
+}
+
+TEST(ConcurrentSkipListTest, MapBasicOperations) {
+  s21::ConcurrentSkipListMap<std::string, int> map;
+  EXPECT_TRUE(map.insert("b", 2));
+  EXPECT_TRUE(map.insert({"a", 1}));
+  EXPECT_FALSE(map.insert("a", 10));
+  EXPECT_EQ(map.at("a"), 1);
+  EXPECT_THROW(map.at("c"), std::out_of_range);
+  EXPECT_EQ(map.find("b")->second, 2);
+  auto it = map.begin();
+  EXPECT_EQ(it->first, "a");
+  auto copy = it;
+  ++it;
+  EXPECT_EQ(it->first, "b");
+  EXPECT_EQ(copy->first, "a");
+  ++it;
+  EXPECT_EQ(it, map.end());
+  EXPECT_TRUE(map.erase("a"));
+  EXPECT_TRUE(map.insert("a", 3));
+  EXPECT_EQ(map.at("a"), 3);
+}
+
+TEST(ConcurrentSkipListTest, MatchesModel) {
+  s21::ConcurrentSkipListSet<int> set;
+  std::set<int> model;
+  std::mt19937 rng(47);
+  for (int step = 0; step < 20000; ++step) {
+    int key = static_cast<int>(rng() % 1000);
+    if (rng() % 2) {
+      ASSERT_EQ(set.insert(key), model.insert(key).second);
+    } else {
+      ASSERT_EQ(set.erase(key), model.erase(key) == 1);
+    }
+  }
+  EXPECT_EQ(set.size(), model.size());
+  std::vector<int> values(set.begin(), set.end());
+  EXPECT_EQ(values, std::vector<int>(model.begin(), model.end()));
+}
+
+TEST(ConcurrentSkipListTest, ConcurrentDisjointInserts) {
+  s21::ConcurrentSkipListSet<int> set;
+  const int kThreads = 4;
+  const int kPerThread = 5000;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&set, t] {
+      for (int i = 0; i < kPerThread; ++i) {
+        EXPECT_TRUE(set.insert(i * kThreads + t));
+      }
+    });
+  }
+  for (std::thread &thread : threads) thread.join();
+  EXPECT_EQ(set.size(), kThreads * kPerThread);
+  int expected = 0;
+  for (int value : set) EXPECT_EQ(value, expected++);
+  EXPECT_EQ(expected, kThreads * kPerThread);
+}
+
+TEST(ConcurrentSkipListTest, ConcurrentChurnKeepsOrderAndCount) {
+  s21::ConcurrentSkipListMap<int, int> map;
+  std::atomic<long> balance{0};
+  std::atomic<bool> stop{false};
+  std::vector<std::thread> writers;
+  for (int t = 0; t < 3; ++t) {
+    writers.emplace_back([&map, &balance, t] {
+      std::mt19937 rng(t);
+      for (int i = 0; i < 20000; ++i) {
+        int key = static_cast<int>(rng() % 256);
+        if (rng() % 2) {
+          if (map.insert(key, key * 2)) balance.fetch_add(1);
+        } else if (map.erase(key)) {
+          balance.fetch_sub(1);
+        }
+      }
+    });
+  }
+  std::thread reader([&map, &stop] {
+    while (!stop.load()) {
+      int last = -1;
+      for (const auto &item : map) {
+        EXPECT_LT(last, item.first);
+        EXPECT_EQ(item.second, item.first * 2);
+        last = item.first;
+      }
+      auto it = map.lower_bound(100);
+      if (it != map.end()) {
+        EXPECT_GE(it->first, 100);
+      }
+    }
+  });
+  for (std::thread &writer : writers) writer.join();
+  stop.store(true);
+  reader.join();
+  EXPECT_EQ(map.size(), static_cast<std::size_t>(balance.load()));
+  std::size_t count = 0;
+  for (auto it = map.begin(); it != map.end(); ++it) ++count;
+  EXPECT_EQ(count, map.size());
+}
@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../lib/s21_concurrent_stack.h"
+
+TEST(ConcurrentStackTest, LifoOrder) {
+  s21::ConcurrentStack<int> a;
+  EXPECT_TRUE(a.empty());
+  for (int i = 0; i < 5; ++i) a.push(i);
+  EXPECT_FALSE(a.empty());
+  int value = -1;
+  for (int i = 4; i >= 0; --i) {
+    EXPECT_TRUE(a.try_pop(value));
+    EXPECT_EQ(value, i);
+  }
+  EXPECT_FALSE(a.try_pop(value));
+  EXPECT_TRUE(a.empty());
+}
+
+TEST(ConcurrentStackTest, RecyclesNodes) {
+  s21::ConcurrentStack<std::string> a;
+  std::string value;
+  for (int round = 0; round < 1000; ++round) {
+    a.push(std::string(50, 'a' + round % 26));
+    a.emplace(3, 'z');
+    EXPECT_TRUE(a.try_pop(value));
+    EXPECT_EQ(value, "zzz");
+    EXPECT_TRUE(a.try_pop(value));
+    EXPECT_EQ(value.size(), 50);
+  }
+}
+
+TEST(ConcurrentStackTest, GrowsAcrossChunks) {
+  s21::ConcurrentStack<int> a;
+  const int kCount = 10000;
+  for (int i = 0; i < kCount; ++i) a.push(i);
+  long long sum = 0;
+  int value = 0;
+  while (a.try_pop(value)) sum += value;
+  EXPECT_EQ(sum, static_cast<long long>(kCount) * (kCount - 1) / 2);
+}
+
+TEST(ConcurrentStackTest, DestructorReleasesElements) {
+  s21::ConcurrentStack<std::string> a;
+  a.push(std::string(100, 'x'));
+  a.push(std::string(100, 'y'));
+}
+
+TEST(ConcurrentStackTest, StressPushPop) {
+  const int kThreads = 8;
+  const int kPerThread = 20000;
+  s21::ConcurrentStack<int> a;
+  std::vector<std::thread> threads;
+  std::vector<long long> popped(kThreads, 0);
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&a, &popped, t] {
+      int value = 0;
+      for (int i = 1; i <= kPerThread; ++i) {
+        a.push(i);
+        if (a.try_pop(value)) popped[t] += value;
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+  long long total = 0;
+  for (long long sum : popped) total += sum;
+  int value = 0;
+  while (a.try_pop(value)) total += value;
+  EXPECT_EQ(total, static_cast<long long>(kThreads) * kPerThread *
+                       (kPerThread + 1) / 2);
+}
@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "../lib/s21_epoch.h"
+
+namespace {
+std::atomic<int> freed{0};
+
+struct Tracked {
+  explicit Tracked(int v) : value(v) {}
+  ~Tracked() { freed.fetch_add(1, std::memory_order_relaxed); }
+  int value;
+};
+
+void drain(s21::epoch::Participant &participant) {
+  for (int i = 0; i < 4; ++i) participant.collect();
+}
+}  // namespace
+
+TEST(EpochTest, RetiredObjectSurvivesWhilePinned) {
+  freed = 0;
+  s21::epoch::Domain domain;
+  s21::epoch::Participant reader(domain);
+  s21::epoch::Participant writer(domain);
+  {
+    auto guard = reader.pin();
+    EXPECT_TRUE(reader.pinned());
+    writer.retire(new Tracked(1));
+    drain(writer);
+    EXPECT_EQ(freed, 0);
+    EXPECT_EQ(domain.pending_count(), 1);
+    EXPECT_EQ(domain.pending_bytes(), sizeof(Tracked));
+  }
+  EXPECT_FALSE(reader.pinned());
+  drain(writer);
+  EXPECT_EQ(freed, 1);
+  EXPECT_EQ(domain.pending_bytes(), 0);
+}
+
+TEST(EpochTest, NestedGuards) {
+  s21::epoch::Domain domain;
+  s21::epoch::Participant participant(domain);
+  {
+    auto outer = participant.pin();
+    {
+      auto inner = participant.pin();
+      EXPECT_TRUE(participant.pinned());
+    }
+    EXPECT_TRUE(participant.pinned());
+  }
+  EXPECT_FALSE(participant.pinned());
+}
+
+TEST(EpochTest, EpochAdvancesOnlyPastPinnedThreads) {
+  s21::epoch::Domain domain;
+  s21::epoch::Participant a(domain);
+  std::uint64_t start = domain.epoch();
+  auto guard = a.pin();
+  EXPECT_TRUE(domain.try_advance());
+  EXPECT_FALSE(domain.try_advance());
+  EXPECT_EQ(domain.epoch(), start + 1);
+}
+
+TEST(EpochTest, RecordsAreReused) {
+  s21::epoch::Domain domain;
+  { s21::epoch::Participant a(domain); }
+  EXPECT_EQ(domain.participants(), 0);
+  s21::epoch::Participant b(domain);
+  EXPECT_EQ(domain.participants(), 1);
+}
+
+TEST(EpochTest, GarbagePerThreadIsBounded) {
+  freed = 0;
+  s21::epoch::Domain domain;
+  s21::epoch::Participant laggard(domain);
+  std::size_t total = s21::epoch::Domain::kMaxPendingPerThread * 3;
+  {
+    auto guard = laggard.pin();
+    std::thread writer([&domain, total] {
+      s21::epoch::Participant participant(domain);
+      for (std::size_t i = 0; i < total; ++i) {
+        participant.retire(new Tracked(static_cast<int>(i)));
+      }
+    });
+    writer.join();
+    EXPECT_EQ(freed, 0);
+    EXPECT_EQ(domain.pending_count(), total);
+  }
+  drain(laggard);
+  EXPECT_EQ(freed, static_cast<int>(total));
+  EXPECT_EQ(domain.pending_count(), 0);
+}
+
+TEST(EpochTest, DomainDestructorFreesEverything) {
+  freed = 0;
+  {
+    s21::epoch::Domain domain;
+    s21::epoch::Participant participant(domain);
+    participant.retire(new Tracked(1));
+  }
+  EXPECT_EQ(freed, 1);
+}
+
+TEST(EpochTest, GlobalDomainShortcuts) {
+  {
+    auto guard = s21::epoch::pin();
+    EXPECT_TRUE(s21::epoch::local().pinned());
+    s21::epoch::retire(new int(5));
+  }
+  EXPECT_FALSE(s21::epoch::local().pinned());
+}
+
+TEST(EpochTest, ThousandsOfChurningThreads) {
+  const int kWaves = 40;
+  const int kThreadsPerWave = 50;
+  const int kSwaps = 50;
+  freed = 0;
+  std::atomic<int> bad_reads{0};
+  {
+    s21::epoch::Domain domain;
+    std::atomic<Tracked *> shared{new Tracked(0)};
+    for (int wave = 0; wave < kWaves; ++wave) {
+      std::vector<std::thread> threads;
+      for (int t = 0; t < kThreadsPerWave; ++t) {
+        threads.emplace_back([&domain, &shared, &bad_reads] {
+          s21::epoch::Participant participant(domain);
+          for (int i = 0; i < kSwaps; ++i) {
+            auto guard = participant.pin();
+            Tracked *current = shared.load(std::memory_order_acquire);
+            if (current->value != 42 && current->value != 0) ++bad_reads;
+            Tracked *old = shared.exchange(new Tracked(42));
+            guard.retire(old);
+          }
+        });
+      }
+      for (auto &thread : threads) thread.join();
+    }
+    EXPECT_EQ(domain.participants(), 0);
+    delete shared.load();
+  }
+  EXPECT_EQ(bad_reads, 0);
+  EXPECT_EQ(freed, kWaves * kThreadsPerWave * kSwaps + 1);
+}
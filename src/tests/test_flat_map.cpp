@@ -0,0 +1,174 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../lib/s21_flat_map.h"
+
+TEST(FlatMapTest, InsertFindErase) {
+  s21::FlatMap<int, std::string> map{{3, "c"}, {1, "a"}, {3, "x"}};
+  EXPECT_EQ(map.size(), 2);
+  EXPECT_EQ(map.at(3), "c");
+  EXPECT_TRUE(map.insert(2, "b").second);
+  EXPECT_FALSE(map.insert({2, "y"}).second);
+  EXPECT_THROW(map.at(4), std::out_of_range);
+  map[4] = "d";
+  EXPECT_EQ((*map.find(4)).second, "d");
+  EXPECT_EQ(map.find(5), map.end());
+  EXPECT_FALSE(map.insert_or_assign(4, "e").second);
+  EXPECT_EQ(map[4], "e");
+  EXPECT_TRUE(map.contains(1));
+  EXPECT_EQ(map.count(9), 0);
+  EXPECT_EQ(map.erase(1), 1);
+  EXPECT_EQ(map.erase(1), 0);
+  map.erase(map.find(2));
+  std::vector<std::pair<int, std::string>> seen;
+  for (auto item : map) seen.emplace_back(item.first, item.second);
+  EXPECT_EQ(seen, (std::vector<std::pair<int, std::string>>{{3, "c"},
+                                                            {4, "e"}}));
+  const s21::FlatMap<int, std::string> &view = map;
+  EXPECT_EQ(view.at(4), "e");
+  EXPECT_EQ(view.find(3).value(), "c");
+  map.clear();
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.begin(), map.end());
+}
+
+TEST(FlatMapTest, ThrowingValueLeavesMapUnchanged) {
+  struct Picky {
+    Picky() = default;
+    explicit Picky(int v) : value(v) {
+      if (v < 0) throw std::invalid_argument("negative");
+    }
+    int value = 0;
+  };
+  s21::FlatMap<int, Picky> map;
+  map.try_emplace(1, 1);
+  map.try_emplace(3, 3);
+  EXPECT_THROW(map.try_emplace(2, -1), std::invalid_argument);
+  EXPECT_EQ(map.size(), 2);
+  EXPECT_EQ(map.values().size(), 2);
+  EXPECT_FALSE(map.contains(2));
+  EXPECT_EQ(map.at(3).value, 3);
+  EXPECT_FALSE(map.try_emplace(1, -1).second);
+}
+
+TEST(FlatMapTest, BoundsMatchStdMap) {
+  s21::FlatMap<int, int> map;
+  std::map<int, int> model;
+  for (int key = 0; key < 200; key += 3) {
+    map.insert(key, key);
+    model.emplace(key, key);
+  }
+  for (int key = -2; key < 203; ++key) {
+    auto lower = model.lower_bound(key);
+    auto upper = model.upper_bound(key);
+    EXPECT_EQ(map.lower_bound(key) - map.begin(),
+              std::distance(model.begin(), lower));
+    EXPECT_EQ(map.upper_bound(key) - map.begin(),
+              std::distance(model.begin(), upper));
+    auto range = map.equal_range(key);
+    EXPECT_EQ(range.second - range.first, model.count(key));
+  }
+  s21::FlatMap<int, int> empty;
+  EXPECT_EQ(empty.lower_bound(1), empty.end());
+  EXPECT_EQ(empty.upper_bound(1), empty.end());
+}
+
+TEST(FlatMapTest, BulkInsertMergesWithExistingKeys) {
+  s21::FlatMap<int, int> map;
+  std::map<int, int> model;
+  std::mt19937 rng(50);
+  for (int round = 0; round < 5; ++round) {
+    std::vector<std::pair<int, int>> batch;
+    for (int i = 0; i < 2000; ++i) {
+      batch.emplace_back(static_cast<int>(rng() % 5000), round * 10000 + i);
+    }
+    map.insert(batch.begin(), batch.end());
+    for (const auto &item : batch) model.insert(item);
+  }
+  ASSERT_EQ(map.size(), model.size());
+  EXPECT_TRUE(std::is_sorted(map.keys().begin(), map.keys().end()));
+  auto it = map.begin();
+  for (const auto &item : model) {
+    EXPECT_EQ(it.key(), item.first);
+    EXPECT_EQ(it.value(), item.second);
+    ++it;
+  }
+  EXPECT_EQ(it, map.end());
+}
+
+TEST(FlatMapTest, CopyMoveSwapMerge) {
+  s21::FlatMap<int, std::string> a{{1, "a"}, {2, "b"}};
+  s21::FlatMap<int, std::string> b = a;
+  b[3] = "c";
+  EXPECT_EQ(a.size(), 2);
+  EXPECT_EQ(b.size(), 3);
+  s21::FlatMap<int, std::string> c = std::move(b);
+  EXPECT_EQ(c.size(), 3);
+  s21::FlatMap<int, std::string> d{{3, "x"}, {4, "d"}};
+  a.merge(d);
+  EXPECT_EQ(a.size(), 4);
+  EXPECT_EQ(a.at(3), "x");
+  EXPECT_TRUE(d.empty());
+  c.merge(a);
+  EXPECT_EQ(c.size(), 4);
+  EXPECT_EQ(c.at(3), "c");
+  EXPECT_EQ(a.size(), 3);
+  EXPECT_EQ(a.at(3), "x");
+  a.swap(c);
+  EXPECT_EQ(a.size(), 4);
+  EXPECT_EQ(c.size(), 3);
+}
+
+TEST(FlatMapTest, IteratorTraitsAndAlgorithms) {
+  using Map = s21::FlatMap<int, int>;
+  static_assert(std::is_same_v<
+                std::iterator_traits<Map::iterator>::iterator_category,
+                std::bidirectional_iterator_tag>);
+  Map map{{1, 10}, {2, 20}, {3, 30}};
+  EXPECT_EQ(std::distance(map.begin(), map.end()), 3);
+  const Map &view = map;
+  auto it = std::next(view.begin());
+  EXPECT_EQ(it.key(), 2);
+  EXPECT_EQ(std::prev(view.end()).value(), 30);
+  EXPECT_TRUE(map.insert_or_assign(0, 0).second);
+  EXPECT_FALSE(map.insert_or_assign(2, 21).second);
+  EXPECT_EQ(std::vector<int>(map.values().begin(), map.values().end()),
+            (std::vector<int>{0, 10, 21, 30}));
+}
+
+TEST(FlatMapTest, MergeLeavesOtherComparator) {
+  struct Order {
+    bool operator()(int a, int b) const { return reverse ? b < a : a < b; }
+    bool reverse = false;
+  };
+  s21::FlatMap<int, int, Order> a(Order{false});
+  s21::FlatMap<int, int, Order> b(Order{true});
+  a.insert(1, 1);
+  a.insert(2, 2);
+  b.insert(2, -2);
+  b.insert(3, 3);
+  b.insert(1, -1);
+  a.merge(b);
+  EXPECT_EQ(std::vector<int>(a.keys().begin(), a.keys().end()),
+            (std::vector<int>{1, 2, 3}));
+  EXPECT_TRUE(b.key_comp().reverse);
+  b.insert(5, 5);
+  EXPECT_EQ(std::vector<int>(b.keys().begin(), b.keys().end()),
+            (std::vector<int>{5, 2, 1}));
+}
+
+TEST(FlatMapTest, CustomCompare) {
+  s21::FlatMap<int, int, std::greater<int>> map{{1, 1}, {3, 3}, {2, 2}};
+  EXPECT_EQ(map.begin().key(), 3);
+  EXPECT_EQ(map.lower_bound(2).key(), 2);
+  EXPECT_EQ(map.upper_bound(2).key(), 1);
+}
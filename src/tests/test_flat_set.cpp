@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+
+#include <iterator>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "../lib/s21_flat_set.h"
+
+TEST(FlatSetTest, InsertFindErase) {
+  s21::FlatSet<std::string> set{"b", "a", "b"};
+  EXPECT_EQ(set.size(), 2);
+  EXPECT_TRUE(set.insert("c").second);
+  EXPECT_FALSE(set.insert("c").second);
+  EXPECT_EQ(*set.find("b"), "b");
+  EXPECT_EQ(set.find("z"), set.end());
+  EXPECT_TRUE(set.contains("a"));
+  EXPECT_EQ(set.erase("a"), 1);
+  set.erase(set.find("b"));
+  EXPECT_EQ(std::vector<std::string>(set.begin(), set.end()),
+            std::vector<std::string>{"c"});
+  EXPECT_EQ(*set.lower_bound("a"), "c");
+  EXPECT_EQ(set.upper_bound("c"), set.end());
+}
+
+TEST(FlatSetTest, MatchesModel) {
+  s21::FlatSet<int> set;
+  std::set<int> model;
+  std::mt19937 rng(50);
+  std::vector<int> batch;
+  for (int step = 0; step < 20000; ++step) {
+    int key = static_cast<int>(rng() % 3000);
+    switch (rng() % 3) {
+      case 0:
+        ASSERT_EQ(set.insert(key).second, model.insert(key).second);
+        break;
+      case 1:
+        ASSERT_EQ(set.erase(key), model.erase(key));
+        break;
+      default:
+        batch.push_back(key);
+    }
+    if (batch.size() == 100) {
+      set.insert(batch.begin(), batch.end());
+      model.insert(batch.begin(), batch.end());
+      batch.clear();
+    }
+    ASSERT_EQ(set.lower_bound(key) - set.begin(),
+              std::distance(model.begin(), model.lower_bound(key)));
+  }
+  EXPECT_EQ(std::vector<int>(set.begin(), set.end()),
+            std::vector<int>(model.begin(), model.end()));
+}
+
+TEST(FlatSetTest, MergeKeepsDuplicatesInSource) {
+  s21::FlatSet<int> a{1, 2, 3};
+  s21::FlatSet<int> b{3, 4};
+  a.merge(b);
+  EXPECT_EQ(a.size(), 4);
+  EXPECT_EQ(b.size(), 1);
+  EXPECT_TRUE(b.contains(3));
+}
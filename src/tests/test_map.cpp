@@ -1,5 +1,12 @@
 #include <gtest/gtest.h>
 
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
 #include "../lib/s21_map.h"
 
 TEST(MapTest, DefaultConstructor) {
@@ -210,4 +217,330 @@ TEST(MapTest, insert_many) {
   EXPECT_EQ((*iter).first, 4);
   ++iter;
   EXPECT_EQ((*iter).first, 5);
-}
\ No newline at end of file
+}
+
+TEST(MapTest, TryEmplaceDoesNotConsumeOnHit) {
+  s21::Map<std::string, std::unique_ptr<int>> a;
+  auto first = a.try_emplace("k", new int(1));
+  EXPECT_TRUE(first.second);
+  std::unique_ptr<int> value(new int(2));
+  auto second = a.try_emplace("k", std::move(value));
+  EXPECT_FALSE(second.second);
+  EXPECT_TRUE(first.first == second.first);
+  ASSERT_NE(value, nullptr);
+  EXPECT_EQ(*a.at("k"), 1);
+}
+
+TEST(MapTest, EmplaceAndMoveInsert) {
+  s21::Map<std::string, std::string> a;
+  EXPECT_TRUE(a.emplace("b", "2").second);
+  EXPECT_FALSE(a.emplace("b", "x").second);
+  std::pair<const std::string, std::string> item("a", std::string(40, 'v'));
+  EXPECT_TRUE(a.insert(std::move(item)).second);
+  EXPECT_TRUE(item.second.empty());
+  a["c"] = "3";
+  EXPECT_EQ(a.size(), 3);
+  EXPECT_EQ(a.at("a"), std::string(40, 'v'));
+  EXPECT_EQ(a.at("b"), "2");
+  EXPECT_FALSE(a.insert_or_assign("b", "4").second);
+  EXPECT_EQ(a.at("b"), "4");
+}
+
+TEST(MapTest, EmplaceHint) {
+  s21::Map<int, int> a;
+  for (int i = 0; i < 100; ++i) a.emplace_hint(a.end(), i, i * i);
+  auto hint = a.emplace_hint(a.end(), 50, 0);
+  EXPECT_EQ((*hint).second, 2500);
+  a.emplace_hint(a.begin(), -1, 1);
+  a.emplace_hint(hint, 1000, 1);
+  EXPECT_EQ(a.size(), 102);
+  int expected = -1;
+  for (auto it = a.begin(); it != a.end(); ++it) {
+    EXPECT_EQ((*it).first, expected);
+    expected = expected == -1 ? 0 : expected == 99 ? 1000 : expected + 1;
+  }
+}
+
+TEST(MapTest, RandomInsertEraseMatchesStd) {
+  s21::Map<int, int> a;
+  std::map<int, int> b;
+  std::mt19937 rng(3);
+  for (int i = 0; i < 20000; ++i) {
+    int key = static_cast<int>(rng() % 2000);
+    if (rng() % 3) {
+      EXPECT_EQ(a.try_emplace(key, i).second, b.try_emplace(key, i).second);
+    } else if (b.erase(key)) {
+      a.erase(a.try_emplace(key).first);
+    }
+  }
+  ASSERT_EQ(a.size(), b.size());
+  auto it = a.begin();
+  for (const auto &item : b) {
+    EXPECT_EQ((*it).first, item.first);
+    EXPECT_EQ((*it).second, item.second);
+    ++it;
+  }
+  EXPECT_TRUE(it == a.end());
+}
+
+TEST(MapTest, CustomCompare) {
+  s21::Map<int, int, std::greater<int>> a{{1, 1}, {3, 3}, {2, 2}};
+  auto it = a.begin();
+  EXPECT_EQ((*it).first, 3);
+  EXPECT_EQ((*++it).first, 2);
+  EXPECT_EQ((*++it).first, 1);
+  EXPECT_EQ((*a.lower_bound(5)).first, 3);
+  EXPECT_EQ(a.key_comp()(2, 1), true);
+  EXPECT_EQ(sizeof(a), sizeof(s21::Map<int, int>));
+}
+
+TEST(MapTest, TransparentLookup) {
+  s21::Map<std::string, int, std::less<>> a;
+  a["alpha"] = 1;
+  a["beta"] = 2;
+  std::string_view probe("beta-suffix", 4);
+  EXPECT_TRUE(a.contains(probe));
+  EXPECT_EQ(a.count(probe), 1);
+  EXPECT_EQ(a.at(probe), 2);
+  EXPECT_EQ((*a.find("alpha")).second, 1);
+  EXPECT_TRUE(a.find(std::string_view("gamma")) == a.end());
+  EXPECT_EQ((*a.lower_bound(std::string_view("b"))).first, "beta");
+  EXPECT_THROW(a.at(std::string_view("gamma")), std::out_of_range);
+}
+
+TEST(MapTest, OpaqueCompareConvertsKey) {
+  s21::Map<std::string, int> a;
+  a["k"] = 1;
+  EXPECT_TRUE(a.contains("k"));
+  EXPECT_EQ(a.count("x"), 0);
+}
+
+TEST(MapTest, BoundsAndRange) {
+  s21::Map<int, int> a;
+  std::map<int, int> b;
+  for (int i = 0; i < 100; i += 10) {
+    a.insert(i, i);
+    b.insert({i, i});
+  }
+  for (int key = -5; key < 105; key += 5) {
+    auto lower = a.lower_bound(key);
+    auto upper = a.upper_bound(key);
+    if (b.lower_bound(key) == b.end()) {
+      EXPECT_TRUE(lower == a.end());
+    } else {
+      EXPECT_EQ((*lower).first, b.lower_bound(key)->first);
+    }
+    if (b.upper_bound(key) == b.end()) {
+      EXPECT_TRUE(upper == a.end());
+    } else {
+      EXPECT_EQ((*upper).first, b.upper_bound(key)->first);
+    }
+  }
+  auto range = a.equal_range(30);
+  EXPECT_EQ((*range.first).first, 30);
+  EXPECT_EQ((*range.second).first, 40);
+  std::vector<int> keys;
+  for (auto &item : a.range(25, 60)) keys.push_back(item.first);
+  EXPECT_EQ(keys, (std::vector<int>{30, 40, 50}));
+  EXPECT_TRUE(a.range(60, 25).empty());
+  EXPECT_TRUE(a.range(91, 1000).empty());
+}
+
+TEST(MapTest, TransparentRangeOfLiterals) {
+  s21::Map<std::string, int, std::less<>> a;
+  for (char c = 'a'; c <= 'z'; ++c) a[std::string(1, c)] = c - 'a';
+  std::vector<std::string> keys;
+  for (auto &item : a.range("c", "f")) keys.push_back(item.first);
+  EXPECT_EQ(keys, (std::vector<std::string>{"c", "d", "e"}));
+  EXPECT_TRUE(a.range("f", "c").empty());
+}
+
+TEST(MapTest, RankAndSelect) {
+  s21::Map<std::string, int, std::less<>> a;
+  for (char c = 'a'; c <= 'z'; ++c) a[std::string(1, c)] = c - 'a';
+  a.erase(a.find("m"));
+  EXPECT_EQ(a.rank("a"), 0);
+  EXPECT_EQ(a.rank("n"), 12);
+  EXPECT_EQ(a.rank(std::string_view("zz")), 25);
+  EXPECT_EQ(a.select(12).first, "n");
+  EXPECT_EQ((*a.nth_element_iterator(0)).first, "a");
+  EXPECT_TRUE(a.nth_element_iterator(25) == a.end());
+  EXPECT_EQ(a.count_range("c", "f"), 3);
+  EXPECT_EQ(a.count_range("f", "c"), 0);
+  EXPECT_EQ(a.count_range(std::string_view("k"), std::string_view("p")), 4);
+}
+
+TEST(MapTest, BuildFromRange) {
+  std::vector<std::pair<int, std::string>> sorted;
+  for (int i = 0; i < 1000; ++i) sorted.emplace_back(i, std::to_string(i));
+  s21::Map<int, std::string> a(sorted.begin(), sorted.end());
+  EXPECT_EQ(a.size(), 1000);
+  EXPECT_EQ(a.select(500).second, "500");
+  std::vector<std::pair<int, std::string>> shuffled{
+      {3, "c"}, {1, "a"}, {3, "x"}, {2, "b"}};
+  s21::Map<int, std::string> b(shuffled.begin(), shuffled.end());
+  EXPECT_EQ(b.size(), 3);
+  EXPECT_EQ(b.at(3), "c");
+  EXPECT_EQ((*b.begin()).first, 1);
+}
+
+TEST(MapTest, BulkInsertAndUpsertMatchStd) {
+  s21::Map<int, int> a;
+  std::map<int, int> b;
+  for (int i = 0; i < 500; i += 2) {
+    a.insert(i, 0);
+    b[i] = 0;
+  }
+  std::vector<std::pair<int, int>> batch;
+  for (int i = 0; i < 800; i += 3) batch.emplace_back(i, i);
+  a.insert_sorted(batch.begin(), batch.end());
+  for (const auto &item : batch) b.insert(item);
+  std::vector<std::pair<int, int>> updates{{900, 1}, {4, 7}, {4, 8}, {5, 5}};
+  a.upsert_sorted(updates.begin(), updates.end());
+  for (const auto &item : updates) b[item.first] = item.second;
+  ASSERT_EQ(a.size(), b.size());
+  std::size_t rank = 0;
+  for (const auto &item : b) {
+    EXPECT_EQ(a.select(rank).first, item.first);
+    EXPECT_EQ(a.select(rank).second, item.second);
+    EXPECT_EQ(a.rank(item.first), rank);
+    ++rank;
+  }
+  a.insert(-1, -1);
+  a.erase(a.find(900));
+  EXPECT_EQ((*a.begin()).first, -1);
+  EXPECT_EQ(a.size(), b.size());
+}
+
+TEST(MapTest, ExtractAndInsertNodeHandle) {
+  s21::Map<int, std::string> a{{1, "a"}, {2, "b"}, {3, "c"}};
+  s21::Map<int, std::string> b{{2, "x"}};
+  auto *address = &a.at(2);
+  auto handle = a.extract(2);
+  ASSERT_FALSE(handle.empty());
+  EXPECT_EQ(handle.key(), 2);
+  EXPECT_EQ(a.size(), 2);
+  EXPECT_FALSE(a.contains(2));
+  EXPECT_TRUE(a.extract(42).empty());
+  handle.mapped() = "moved";
+  auto refused = b.insert(std::move(handle));
+  EXPECT_FALSE(refused.inserted);
+  EXPECT_EQ((*refused.position).second, "x");
+  ASSERT_TRUE(refused.node);
+  auto accepted = a.insert(std::move(refused.node));
+  EXPECT_TRUE(accepted.inserted);
+  EXPECT_TRUE(accepted.node.empty());
+  EXPECT_EQ(&a.at(2), address);
+  EXPECT_EQ(a.at(2), "moved");
+  EXPECT_EQ(a.rank(3), 2);
+  auto dropped = a.extract(a.begin());
+  EXPECT_EQ(dropped.value().first, 1);
+  EXPECT_EQ((*a.begin()).first, 2);
+}
+
+TEST(MapTest, MergeMatchesStd) {
+  for (int other_size : {5, 3000}) {
+    s21::Map<int, int> a;
+    s21::Map<int, int> b;
+    std::map<int, int> c;
+    std::map<int, int> d;
+    for (int i = 0; i < 2000; i += 2) {
+      a.insert(i, i);
+      c.insert({i, i});
+    }
+    for (int i = 0; i < other_size; i += 3) {
+      b.insert(i, -i);
+      d.insert({i, -i});
+    }
+    a.merge(b);
+    c.merge(d);
+    ASSERT_EQ(a.size(), c.size());
+    ASSERT_EQ(b.size(), d.size());
+    std::size_t rank = 0;
+    for (const auto &item : c) {
+      EXPECT_EQ(a.select(rank++), item);
+    }
+    rank = 0;
+    for (const auto &item : d) {
+      EXPECT_EQ(b.select(rank++), item);
+    }
+    auto it = a.nth_element_iterator(a.size() - 1);
+    for (auto item = c.rbegin(); item != c.rend(); ++item, --it) {
+      ASSERT_EQ((*it).first, item->first);
+    }
+  }
+}
+
+namespace {
+// Checks AVL balance, weights and parent links at every node of the map.
+template <class MapType>
+bool IsBalanced(MapType &map) {
+  for (auto it = map.begin(); it != map.end(); ++it) {
+    auto *node = it.iterated_node_;
+    int left = node->left ? node->left->height : -1;
+    int right = node->right ? node->right->height : -1;
+    std::size_t weight = 1 + (node->left ? node->left->weight : 0) +
+                         (node->right ? node->right->weight : 0);
+    if (left - right > 1 || right - left > 1) return false;
+    if (node->height != std::max(left, right) + 1) return false;
+    if (node->weight != weight) return false;
+    if (node->left && node->left->parent != node) return false;
+    if (node->right && node->right->parent != node) return false;
+  }
+  return true;
+}
+}  // namespace
+
+TEST(MapTest, RangeEraseMatchesStd) {
+  std::mt19937 rng(11);
+  s21::Map<int, int> a;
+  std::map<int, int> b;
+  for (int i = 0; i < 3000; ++i) {
+    int key = static_cast<int>(rng() % 10000);
+    a.insert(key, i);
+    b.insert({key, i});
+  }
+  for (int round = 0; round < 50; ++round) {
+    int lo = static_cast<int>(rng() % 10000);
+    int hi = lo + static_cast<int>(rng() % 500);
+    auto last = a.erase(a.lower_bound(lo), a.lower_bound(hi));
+    b.erase(b.lower_bound(lo), b.lower_bound(hi));
+    EXPECT_EQ(last, a.lower_bound(hi));
+    ASSERT_EQ(a.size(), b.size());
+  }
+  a.erase(a.begin(), a.lower_bound(2000));
+  b.erase(b.begin(), b.lower_bound(2000));
+  a.erase(a.lower_bound(9000), a.end());
+  b.erase(b.lower_bound(9000), b.end());
+  ASSERT_EQ(a.size(), b.size());
+  EXPECT_TRUE(IsBalanced(a));
+  auto it = a.begin();
+  for (const auto &item : b) {
+    EXPECT_EQ(*it, item);
+    ++it;
+  }
+  it = a.nth_element_iterator(a.size() - 1);
+  for (auto item = b.rbegin(); item != b.rend(); ++item, --it) {
+    ASSERT_EQ((*it).first, item->first);
+  }
+}
+
+TEST(MapTest, ExtractRangeAndEraseIf) {
+  s21::Map<int, int> a;
+  for (int i = 0; i < 1000; ++i) a.insert(i, i * i);
+  s21::Map<int, int> middle = a.extract_range(100, 200);
+  EXPECT_EQ(middle.size(), 100);
+  EXPECT_EQ(a.size(), 900);
+  EXPECT_EQ((*middle.begin()).first, 100);
+  EXPECT_EQ(middle.select(99).first, 199);
+  EXPECT_EQ(a.rank(200), 100);
+  EXPECT_TRUE(a.extract_range(5, 5).empty());
+  EXPECT_TRUE(IsBalanced(a));
+  EXPECT_TRUE(IsBalanced(middle));
+  EXPECT_EQ(a.erase_if([](const auto &item) { return item.first % 2; }),
+            450);
+  EXPECT_EQ(a.size(), 450);
+  EXPECT_EQ(a.select(50).first, 100 + 200 - 100);
+  EXPECT_EQ(a.erase_if([](const auto &) { return false; }), 0);
+  EXPECT_TRUE(IsBalanced(a));
+}
@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../lib/s21_mpmc_queue.h"
+
+TEST(MpmcQueueTest, CapacityIsRoundedUp) {
+  s21::MpmcQueue<int> a(5);
+  EXPECT_EQ(a.capacity(), 8);
+  EXPECT_TRUE(a.empty());
+  EXPECT_ANY_THROW(s21::MpmcQueue<int>(1));
+}
+
+TEST(MpmcQueueTest, TryPushTryPop) {
+  s21::MpmcQueue<int> a(4);
+  for (int i = 0; i < 4; ++i) EXPECT_TRUE(a.try_push(i));
+  EXPECT_FALSE(a.try_push(4));
+  EXPECT_EQ(a.size(), 4);
+  int value = -1;
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_TRUE(a.try_pop(value));
+    EXPECT_EQ(value, i);
+  }
+  EXPECT_FALSE(a.try_pop(value));
+}
+
+TEST(MpmcQueueTest, WrapAround) {
+  s21::MpmcQueue<int> a(2);
+  int value = 0;
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_TRUE(a.try_push(i));
+    EXPECT_TRUE(a.try_pop(value));
+    EXPECT_EQ(value, i);
+  }
+}
+
+TEST(MpmcQueueTest, MoveOnlyAndStrings) {
+  s21::MpmcQueue<std::string> a(4);
+  a.push(std::string(100, 'x'));
+  a.emplace(3, 'y');
+  std::string value;
+  a.pop(value);
+  EXPECT_EQ(value.size(), 100);
+  a.pop(value);
+  EXPECT_EQ(value, "yyy");
+}
+
+TEST(MpmcQueueTest, DestructorReleasesElements) {
+  s21::MpmcQueue<std::string> a(4);
+  a.push(std::string(100, 'x'));
+  a.push(std::string(100, 'y'));
+}
+
+TEST(MpmcQueueTest, PopBulk) {
+  s21::MpmcQueue<int> a(8);
+  for (int i = 0; i < 6; ++i) a.push(i);
+  std::vector<int> out(4);
+  EXPECT_EQ(a.try_pop_bulk(out.begin(), 4), 4);
+  EXPECT_EQ(out, (std::vector<int>{0, 1, 2, 3}));
+  EXPECT_EQ(a.pop_bulk(out.begin(), 4), 2);
+  EXPECT_EQ(out[0], 4);
+  EXPECT_EQ(out[1], 5);
+  EXPECT_EQ(a.try_pop_bulk(out.begin(), 4), 0);
+}
+
+TEST(MpmcQueueTest, BlockingManyProducersManyConsumers) {
+  const int kThreads = 4;
+  const int kPerThread = 20000;
+  s21::MpmcQueue<int> a(16);
+  std::vector<std::thread> threads;
+  std::vector<long long> sums(kThreads, 0);
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&a, t] {
+      for (int i = 1; i <= kPerThread; ++i) a.push(i + t * kPerThread);
+    });
+    threads.emplace_back([&a, &sums, t] {
+      int value = 0;
+      for (int i = 0; i < kPerThread; ++i) {
+        a.pop(value);
+        sums[t] += value;
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+  long long total = 0;
+  for (long long sum : sums) total += sum;
+  long long n = static_cast<long long>(kThreads) * kPerThread;
+  EXPECT_EQ(total, n * (n + 1) / 2);
+  EXPECT_TRUE(a.empty());
+}
+
+TEST(MpmcQueueTest, BlockingBulkConsumer) {
+  const int kCount = 50000;
+  s21::MpmcQueue<int> a(8);
+  std::thread producer([&a] {
+    for (int i = 0; i < kCount; ++i) a.push(i);
+  });
+  std::vector<int> out(16);
+  int expected = 0;
+  bool ordered = true;
+  while (expected < kCount) {
+    std::size_t count = a.pop_bulk(out.begin(), out.size());
+    for (std::size_t i = 0; i < count; ++i) {
+      if (out[i] != expected++) ordered = false;
+    }
+  }
+  producer.join();
+  EXPECT_TRUE(ordered);
+}
@@ -1,6 +1,14 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+#include <string_view>
+
 #include "../lib/s21_multiset.h"
+#include "../lib/s21_parallel_tree.h"
 
 TEST(MultisetTest, DefaultConstructor) {
   s21::Multiset<int> a;
@@ -202,7 +210,211 @@ TEST(MultisetTest, insert_many) {
   EXPECT_EQ(iter.iterated_node_->key_.second, 1);
 }
 
+TEST(MultisetTest, EmplaceCountsDuplicates) {
+  s21::Multiset<std::string> a;
+  a.emplace("b");
+  a.emplace(1, 'b');
+  a.insert(std::string("b"));
+  a.emplace_hint(a.begin(), "a");
+  EXPECT_EQ(a.size(), 4);
+  auto it = a.find("b");
+  EXPECT_EQ(it.iterated_node_->key_.second, 3);
+  EXPECT_EQ(*a.begin(), "a");
+}
+
+TEST(MultisetTest, CustomCompareAndTransparentCount) {
+  s21::Multiset<int, std::greater<int>> a{1, 3, 3, 2};
+  std::vector<int> order;
+  for (auto it = a.begin(); it != a.end(); ++it) order.push_back(*it);
+  EXPECT_EQ(order, (std::vector<int>{3, 3, 2, 1}));
+  s21::Multiset<std::string, std::less<>> b{"a", "b", "b"};
+  EXPECT_EQ(b.count(std::string_view("b")), 2);
+  EXPECT_EQ(b.count(std::string_view("c")), 0);
+  EXPECT_EQ(*b.lower_bound(std::string_view("ab")), "b");
+}
+
+TEST(MultisetTest, IteratesEveryDuplicate) {
+  s21::Multiset<int> a{2, 1, 2, 1};
+  std::vector<int> order;
+  for (auto it = a.begin(); it != a.end(); ++it) order.push_back(*it);
+  EXPECT_EQ(order, (std::vector<int>{1, 1, 2, 2}));
+}
+
+TEST(MultisetTest, EqualRangeAndRangeCoverDuplicates) {
+  s21::Multiset<int> a{1, 2, 2, 2, 3, 5};
+  auto range = a.equal_range(2);
+  int count = 0;
+  for (auto it = range.first; it != range.second; ++it) {
+    EXPECT_EQ(*it, 2);
+    ++count;
+  }
+  EXPECT_EQ(count, 3);
+  EXPECT_EQ(*a.upper_bound(2), 3);
+  EXPECT_EQ(a.size(), 6);
+  std::vector<int> window;
+  for (int key : a.range(2, 5)) window.push_back(key);
+  EXPECT_EQ(window, (std::vector<int>{2, 2, 2, 3}));
+}
+
+TEST(MultisetTest, OrderStatisticsMatchSortedVector) {
+  s21::Multiset<int> a;
+  std::vector<int> sorted;
+  std::mt19937 rng(11);
+  for (int i = 0; i < 3000; ++i) {
+    int key = static_cast<int>(rng() % 200);
+    if (rng() % 4 == 0 && a.contains(key)) {
+      a.erase(a.find(key));
+      sorted.erase(std::find(sorted.begin(), sorted.end(), key));
+    } else {
+      a.insert(key);
+      sorted.insert(std::upper_bound(sorted.begin(), sorted.end(), key), key);
+    }
+  }
+  ASSERT_EQ(a.size(), sorted.size());
+  for (std::size_t k = 0; k < sorted.size(); k += 7) {
+    EXPECT_EQ(a.select(k), sorted[k]);
+    EXPECT_EQ(*a.nth_element_iterator(k), sorted[k]);
+  }
+  for (int key = -1; key <= 201; key += 3) {
+    auto below = std::lower_bound(sorted.begin(), sorted.end(), key);
+    EXPECT_EQ(a.rank(key), static_cast<std::size_t>(below - sorted.begin()));
+  }
+  auto lo = std::lower_bound(sorted.begin(), sorted.end(), 50);
+  auto hi = std::lower_bound(sorted.begin(), sorted.end(), 150);
+  EXPECT_EQ(a.count_range(50, 150), static_cast<std::size_t>(hi - lo));
+  EXPECT_EQ(a.count_range(150, 50), 0);
+  EXPECT_THROW(a.select(sorted.size()), std::out_of_range);
+}
+
+TEST(MultisetTest, NthIteratorWalksDuplicates) {
+  s21::Multiset<int> a{5, 5, 5, 7};
+  auto it = a.nth_element_iterator(1);
+  EXPECT_EQ(*it, 5);
+  ++it;
+  EXPECT_EQ(*it, 5);
+  ++it;
+  EXPECT_EQ(*it, 7);
+  EXPECT_TRUE(a.nth_element_iterator(4) == a.end());
+}
+
+TEST(MultisetTest, InsertSortedAddsCounts) {
+  std::vector<int> batch{5, 1, 5, 3, 1, 5};
+  s21::Multiset<int> a(batch.begin(), batch.end());
+  EXPECT_EQ(a.size(), 6);
+  EXPECT_EQ(a.count(5), 3);
+  a.insert_sorted(batch.begin(), batch.begin() + 3);
+  EXPECT_EQ(a.size(), 9);
+  EXPECT_EQ(a.count(1), 3);
+  EXPECT_EQ(a.count(5), 5);
+  EXPECT_EQ(a.select(8), 5);
+  EXPECT_EQ(a.rank(5), 4);
+}
+
+TEST(MultisetTest, ExtractCarriesAllOccurrences) {
+  s21::Multiset<int> a{1, 2, 2, 2, 3};
+  s21::Multiset<int> b{2, 5};
+  auto handle = a.extract(2);
+  EXPECT_EQ(handle.value(), 2);
+  EXPECT_EQ(a.size(), 2);
+  EXPECT_EQ(a.count(2), 0);
+  b.insert(std::move(handle));
+  EXPECT_EQ(b.size(), 5);
+  EXPECT_EQ(b.count(2), 4);
+  a.merge(b);
+  EXPECT_TRUE(b.empty());
+  EXPECT_EQ(a.size(), 7);
+  EXPECT_EQ(a.count(2), 4);
+  EXPECT_EQ(a.select(6), 5);
+  EXPECT_EQ(a.rank(3), 5);
+}
+
+TEST(MultisetTest, RangeEraseKeepsPartialNodes) {
+  s21::Multiset<int> a{1, 2, 2, 2, 3, 4, 4, 5};
+  std::multiset<int> b{1, 2, 2, 2, 3, 4, 4, 5};
+  auto first = a.begin();
+  ++first;
+  ++first;
+  auto last = a.find(4);
+  ++last;
+  auto position = a.erase(first, last);
+  auto b_first = std::next(b.begin(), 2);
+  b.erase(b_first, std::next(b.find(4)));
+  EXPECT_EQ(*position, 4);
+  EXPECT_EQ(a.size(), b.size());
+  EXPECT_EQ(a.count(2), 1);
+  EXPECT_EQ(a.count(4), 1);
+  first = a.find(5);
+  EXPECT_EQ(*a.erase(a.begin(), first), 5);
+  EXPECT_EQ(a.size(), 1);
+  s21::Multiset<int> c{7, 7, 7};
+  auto second = c.begin();
+  ++second;
+  auto third = second;
+  ++third;
+  c.erase(second, third);
+  EXPECT_EQ(c.size(), 2);
+}
+
+TEST(MultisetTest, ExtractRangeAndEraseIf) {
+  s21::Multiset<int> a{1, 1, 2, 3, 3, 3, 4};
+  s21::Multiset<int> middle = a.extract_range(2, 4);
+  EXPECT_EQ(middle.size(), 4);
+  EXPECT_EQ(a.size(), 3);
+  EXPECT_EQ(middle.erase_if([](int value) { return value == 3; }), 3);
+  EXPECT_EQ(middle.size(), 1);
+}
+
+TEST(MultisetTest, SetAlgebraCombinesMultiplicities) {
+  s21::TaskScheduler scheduler(2);
+  std::mt19937 rng(5);
+  for (int op = 0; op < 4; ++op) {
+    std::map<int, int> left;
+    std::map<int, int> right;
+    s21::Multiset<int> a;
+    s21::Multiset<int> b;
+    for (int i = 0; i < 15000; ++i) {
+      int key = static_cast<int>(rng() % 5000);
+      ++left[key];
+      a.insert(key);
+    }
+    for (int i = 0; i < 15000; ++i) {
+      int key = static_cast<int>(rng() % 5000);
+      ++right[key];
+      b.insert(key);
+    }
+    std::map<int, int> expected = left;
+    for (const auto &item : right) {
+      int &count = expected[item.first];
+      if (op == 0) count += item.second;
+      if (op == 1) count = std::min(count, item.second);
+      if (op == 2) count = std::max(count - item.second, 0);
+      if (op == 3) count = std::abs(count - item.second);
+    }
+    if (op == 1) {
+      for (auto &item : expected) {
+        if (!right.count(item.first)) item.second = 0;
+      }
+    }
+    if (op == 0) a.set_union(b, s21::ParallelFork(scheduler));
+    if (op == 1) a.set_intersection(b, s21::ParallelFork(scheduler));
+    if (op == 2) a.set_difference(b);
+    if (op == 3) {
+      a.set_symmetric_difference(b, s21::ParallelFork(scheduler));
+    }
+    EXPECT_TRUE(b.empty());
+    std::size_t total = 0;
+    for (const auto &item : expected) {
+      ASSERT_EQ(a.count(item.first), item.second);
+      if (item.second) {
+        ASSERT_EQ(a.rank(item.first), total);
+      }
+      total += item.second;
+    }
+    EXPECT_EQ(a.size(), total);
+  }
+}
+
 int main(int argc, char *argv[]) {
   testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
-}
\ No newline at end of file
+}
@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#include "../lib/s21_map.h"
+#include "../lib/s21_multiset.h"
+#include "../lib/s21_parallel_tree.h"
+#include "../lib/s21_set.h"
+
+TEST(ParallelTreeTest, SlicesCoverTreeInOrder) {
+  s21::Map<int, int> map;
+  for (int i = 0; i < 10000; ++i) map.insert(i * 3 % 10007, i);
+  for (std::size_t chunks : {1, 7, 64, 20000}) {
+    auto slices = map.slices(chunks);
+    ASSERT_FALSE(slices.empty());
+    EXPECT_EQ(slices[0].begin(), map.begin());
+    EXPECT_EQ(slices[slices.size() - 1].end(), map.end());
+    std::size_t seen = 0;
+    std::size_t largest = 0;
+    int previous = -1;
+    for (const auto &slice : slices) {
+      std::size_t count = 0;
+      for (auto &item : slice) {
+        EXPECT_LT(previous, item.first);
+        previous = item.first;
+        ++count;
+      }
+      EXPECT_EQ(count, slice.size());
+      largest = std::max(largest, count);
+      seen += count;
+    }
+    EXPECT_EQ(seen, map.size());
+    EXPECT_LE(largest, 2 * ((map.size() + chunks - 1) / chunks));
+  }
+  s21::Map<int, int> empty;
+  EXPECT_TRUE(empty.slices(4).empty());
+}
+
+TEST(ParallelTreeTest, ForEachAndReduce) {
+  s21::TaskScheduler scheduler(3);
+  s21::Map<int, std::int64_t> map;
+  for (int i = 1; i <= 50000; ++i) map.insert(i, i);
+  std::atomic<std::int64_t> total{0};
+  s21::parallel_for_each(scheduler, map, [&total](const auto &item) {
+    total.fetch_add(item.second, std::memory_order_relaxed);
+  });
+  EXPECT_EQ(total.load(), std::int64_t{50000} * 50001 / 2);
+  std::int64_t sum = s21::parallel_reduce(
+      scheduler, map, std::int64_t{0},
+      [](std::int64_t acc, const auto &item) { return acc + item.second; },
+      [](std::int64_t a, std::int64_t b) { return a + b; });
+  EXPECT_EQ(sum, total.load());
+  s21::Multiset<int> multiset{1, 1, 2, 3, 3, 3};
+  int counts[4] = {};
+  auto histogram = s21::parallel_reduce(
+      scheduler, multiset, s21::Vector<int>{0, 0, 0, 0},
+      [](s21::Vector<int> &acc, int value) { ++acc[value]; },
+      [](s21::Vector<int> acc, const s21::Vector<int> &part) {
+        for (std::size_t i = 0; i < acc.size(); ++i) acc[i] += part[i];
+        return acc;
+      });
+  for (auto it = multiset.begin(); it != multiset.end(); ++it) ++counts[*it];
+  for (int i = 0; i < 4; ++i) EXPECT_EQ(histogram[i], counts[i]);
+  s21::Set<std::string> words{"d", "a", "c", "b", "e"};
+  std::string joined = s21::parallel_reduce(
+      scheduler, words, std::string(),
+      [](std::string acc, const auto &item) { return acc + item.first; },
+      [](std::string a, const std::string &b) { return a + b; });
+  EXPECT_EQ(joined, "abcde");
+}
+
+TEST(ParallelTreeTest, ExportKeepsOrder) {
+  s21::TaskScheduler scheduler(2);
+  s21::Map<int, std::string> map;
+  for (int i = 0; i < 3000; ++i) map.insert(2999 - i, std::to_string(i));
+  auto pairs = s21::parallel_export(scheduler, map);
+  ASSERT_EQ(pairs.size(), map.size());
+  for (std::size_t i = 0; i < pairs.size(); ++i) {
+    EXPECT_EQ(pairs[i].first, static_cast<int>(i));
+    EXPECT_EQ(pairs[i].second, std::to_string(2999 - i));
+  }
+  s21::Set<int> set{5, 1, 3};
+  auto keys = s21::parallel_export(scheduler, set);
+  ASSERT_EQ(keys.size(), 3);
+  EXPECT_EQ(keys[0], 1);
+  EXPECT_EQ(keys[2], 5);
+  s21::Multiset<int> multiset{2, 2, 1, 3, 3, 3};
+  auto values = s21::parallel_export(scheduler, multiset);
+  ASSERT_EQ(values.size(), 6);
+  EXPECT_EQ(values[1], 2);
+  EXPECT_EQ(values[5], 3);
+  auto doubled = s21::parallel_export(scheduler, map, [](const auto &item) {
+    return item.first * 2;
+  });
+  EXPECT_EQ(doubled[10], 20);
+}
@@ -0,0 +1,214 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../lib/s21_persistent_tree.h"
+
+namespace {
+template <typename View, typename Model>
+void ExpectSameMap(const View &view, const Model &model) {
+  ASSERT_EQ(view.size(), model.size());
+  auto it = view.begin();
+  for (const auto &item : model) {
+    ASSERT_NE(it, view.end());
+    EXPECT_EQ(it->first, item.first);
+    EXPECT_EQ(it->second, item.second);
+    ++it;
+  }
+  EXPECT_EQ(it, view.end());
+}
+
+// Value whose copy throws once copies_left copies have been made.
+int copies_left = -1;
+
+struct Boom {
+  Boom() = default;
+  explicit Boom(int v) : value(v) {}
+  Boom(const Boom &other) : value(other.value) {
+    if (copies_left == 0) throw std::runtime_error("boom");
+    if (copies_left > 0) --copies_left;
+  }
+  Boom &operator=(const Boom &other) = default;
+
+  int value = 0;
+};
+}  // namespace
+
+TEST(PersistentMapTest, InsertFindErase) {
+  s21::PersistentMap<int, std::string> map{{2, "b"}, {1, "a"}, {3, "c"}};
+  EXPECT_EQ(map.size(), 3);
+  EXPECT_FALSE(map.insert(2, "x").second);
+  EXPECT_EQ(map.at(2), "b");
+  auto result = map.insert_or_assign(2, "x");
+  EXPECT_FALSE(result.second);
+  EXPECT_EQ(result.first->second, "x");
+  map[4] = "d";
+  EXPECT_EQ(map.at(4), "d");
+  EXPECT_TRUE(map.contains(1));
+  EXPECT_EQ(map.find(5), map.end());
+  EXPECT_EQ(map.find(3)->second, "c");
+  EXPECT_EQ(map.erase(1), 1);
+  EXPECT_EQ(map.erase(1), 0);
+  EXPECT_THROW(map.at(1), std::out_of_range);
+  EXPECT_EQ(map.begin()->first, 2);
+  EXPECT_EQ(map.lower_bound(3)->first, 3);
+  EXPECT_EQ(map.rank(4), 2);
+  EXPECT_EQ(map.select(2).second, "d");
+  EXPECT_THROW(map.select(3), std::out_of_range);
+  map.clear();
+  EXPECT_TRUE(map.empty());
+}
+
+TEST(PersistentMapTest, SnapshotIsUnaffectedByWrites) {
+  s21::PersistentMap<int, int> map;
+  for (int i = 0; i < 100; ++i) map.insert(i, i);
+  auto snapshot = map.snapshot();
+  for (int i = 0; i < 100; i += 2) map.erase(i);
+  for (int i = 1; i < 100; i += 2) map[i] = -i;
+  map.insert(1000, 0);
+  EXPECT_EQ(snapshot.size(), 100);
+  for (int i = 0; i < 100; ++i) EXPECT_EQ(snapshot.at(i), i);
+  EXPECT_FALSE(snapshot.contains(1000));
+  EXPECT_EQ(map.size(), 51);
+  EXPECT_EQ(map.at(99), -99);
+}
+
+TEST(PersistentMapTest, ThrowingCopyLeavesTreeIntact) {
+  for (int budget = 0; budget < 12; ++budget) {
+    s21::PersistentMap<int, Boom> map;
+    for (int i = 0; i < 64; ++i) map.insert(i, Boom(i));
+    auto snapshot = map.snapshot();
+    copies_left = budget;
+    bool inserted = false;
+    bool erased = false;
+    try {
+      inserted = map.insert(100, Boom(100)).second;
+      erased = map.erase(5) == 1;
+    } catch (const std::runtime_error &) {
+    }
+    copies_left = -1;
+    ASSERT_EQ(map.size(), 64 + inserted - erased);
+    for (int i = 0; i < 64; ++i) {
+      if (i != 5 || !erased) {
+        EXPECT_EQ(map.at(i).value, i);
+      }
+      EXPECT_EQ(snapshot.at(i).value, i);
+    }
+    EXPECT_EQ(map.contains(100), inserted);
+    EXPECT_EQ(map.contains(5), !erased);
+    EXPECT_EQ(snapshot.size(), 64);
+  }
+}
+
+TEST(PersistentMapTest, CopiesDivergeIndependently) {
+  s21::PersistentMap<int, int> a{{1, 1}, {2, 2}};
+  s21::PersistentMap<int, int> b = a;
+  a.insert(3, 3);
+  b.erase(1);
+  b[2] = 20;
+  EXPECT_EQ(a.size(), 3);
+  EXPECT_EQ(a.at(2), 2);
+  EXPECT_EQ(b.size(), 1);
+  EXPECT_EQ(b.at(2), 20);
+}
+
+TEST(PersistentMapTest, MatchesModelAcrossSnapshots) {
+  s21::PersistentMap<int, int> map;
+  std::map<int, int> model;
+  std::vector<s21::PersistentMap<int, int>::snapshot_type> snapshots;
+  std::vector<std::map<int, int>> models;
+  std::mt19937 rng(45);
+  for (int step = 0; step < 20000; ++step) {
+    int key = static_cast<int>(rng() % 500);
+    switch (rng() % 3) {
+      case 0:
+        map.insert_or_assign(key, step);
+        model[key] = step;
+        break;
+      case 1:
+        map.insert(key, step);
+        model.insert({key, step});
+        break;
+      default:
+        ASSERT_EQ(map.erase(key), model.erase(key));
+    }
+    if (step % 1000 == 0) {
+      snapshots.push_back(map.snapshot());
+      models.push_back(model);
+    }
+  }
+  ExpectSameMap(map, model);
+  for (std::size_t i = 0; i < snapshots.size(); ++i) {
+    ExpectSameMap(snapshots[i], models[i]);
+  }
+  for (std::size_t k = 0; k < model.size(); k += 37) {
+    auto it = model.begin();
+    std::advance(it, k);
+    EXPECT_EQ(map.select(k).first, it->first);
+    EXPECT_EQ(map.rank(it->first), k);
+  }
+}
+
+TEST(PersistentMapTest, ReadersOnOtherThreadsSeeFixedVersions) {
+  s21::PersistentMap<int, int> map;
+  for (int i = 0; i < 1000; ++i) map.insert(i, 0);
+  std::vector<std::thread> readers;
+  for (int version = 1; version <= 4; ++version) {
+    auto snapshot = map.snapshot();
+    readers.emplace_back([snapshot, version] {
+      for (int pass = 0; pass < 20; ++pass) {
+        long long sum = 0;
+        std::size_t count = 0;
+        for (const auto &item : snapshot) {
+          sum += item.second;
+          ++count;
+        }
+        EXPECT_EQ(count, 1000 + 100 * (version - 1));
+        EXPECT_EQ(sum, static_cast<long long>(version - 1) * 1000);
+      }
+    });
+    for (int i = 0; i < 1000; ++i) map[i] = version;
+    for (int i = 0; i < 100; ++i) map.insert(1000 * version + i, 0);
+  }
+  for (std::thread &reader : readers) reader.join();
+  EXPECT_EQ(map.size(), 1400);
+}
+
+TEST(PersistentSetTest, InsertEraseAndSnapshot) {
+  s21::PersistentSet<int> set{5, 1, 3};
+  EXPECT_FALSE(set.insert(3).second);
+  EXPECT_EQ(*set.insert(4).first, 4);
+  auto snapshot = set.snapshot();
+  EXPECT_EQ(set.erase(1), 1);
+  set.insert(0);
+  std::vector<int> now(set.begin(), set.end());
+  std::vector<int> then(snapshot.begin(), snapshot.end());
+  EXPECT_EQ(now, (std::vector<int>{0, 3, 4, 5}));
+  EXPECT_EQ(then, (std::vector<int>{1, 3, 4, 5}));
+  EXPECT_EQ(*snapshot.find(1), 1);
+  EXPECT_EQ(set.find(1), set.end());
+  EXPECT_EQ(set.select(1), 3);
+  EXPECT_EQ(set.rank(5), 3);
+}
+
+TEST(PersistentSetTest, MatchesModel) {
+  s21::PersistentSet<int> set;
+  std::set<int> model;
+  std::mt19937 rng(7);
+  for (int step = 0; step < 20000; ++step) {
+    int key = static_cast<int>(rng() % 2000);
+    if (rng() % 2) {
+      EXPECT_EQ(set.insert(key).second, model.insert(key).second);
+    } else {
+      EXPECT_EQ(set.erase(key), model.erase(key));
+    }
+  }
+  std::vector<int> values(set.begin(), set.end());
+  EXPECT_EQ(values, std::vector<int>(model.begin(), model.end()));
+}
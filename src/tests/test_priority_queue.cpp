@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../lib/s21_priority_queue.h"
+
+TEST(PriorityQueueTest, DefaultIsMaxHeap) {
+  s21::PriorityQueue<int> a;
+  EXPECT_TRUE(a.empty());
+  EXPECT_ANY_THROW(a.top());
+  EXPECT_ANY_THROW(a.pop());
+  a.push(3);
+  a.push(7);
+  a.push(1);
+  EXPECT_EQ(a.size(), 3);
+  EXPECT_EQ(a.top(), 7);
+  a.pop();
+  EXPECT_EQ(a.top(), 3);
+}
+
+TEST(PriorityQueueTest, HeapifyConstructor) {
+  s21::PriorityQueue<int> a{5, 1, 9, 3, 7, 2};
+  std::vector<int> out;
+  while (!a.empty()) {
+    out.push_back(a.top());
+    a.pop();
+  }
+  EXPECT_EQ(out, (std::vector<int>{9, 7, 5, 3, 2, 1}));
+}
+
+TEST(PriorityQueueTest, ContainerConstructor) {
+  s21::Vector<int> items{4, 8, 1};
+  s21::PriorityQueue<int, s21::Vector<int>, std::greater<int>> a(
+      std::move(items));
+  EXPECT_EQ(a.top(), 1);
+}
+
+template <std::size_t Arity>
+void check_against_std() {
+  std::mt19937 rng(Arity);
+  s21::PriorityQueue<int, s21::Vector<int>, std::less<int>, Arity> a;
+  std::priority_queue<int> b;
+  for (int i = 0; i < 5000; ++i) {
+    int value = static_cast<int>(rng() % 1000);
+    if (rng() % 3 == 0 && !b.empty()) {
+      EXPECT_EQ(a.top(), b.top());
+      a.pop();
+      b.pop();
+    } else {
+      a.push(value);
+      b.push(value);
+    }
+  }
+  while (!b.empty()) {
+    EXPECT_EQ(a.top(), b.top());
+    a.pop();
+    b.pop();
+  }
+  EXPECT_TRUE(a.empty());
+}
+
+TEST(PriorityQueueTest, ArityTwoFourEightMatchStd) {
+  check_against_std<2>();
+  check_against_std<4>();
+  check_against_std<8>();
+}
+
+TEST(PriorityQueueTest, MoveAndSwap) {
+  s21::PriorityQueue<std::string> a{"b", "c", "a"};
+  s21::PriorityQueue<std::string> b(std::move(a));
+  EXPECT_EQ(b.top(), "c");
+  s21::PriorityQueue<std::string> c;
+  c.insert_many(std::string("x"), std::string("y"));
+  c.swap(b);
+  EXPECT_EQ(b.top(), "y");
+  EXPECT_EQ(c.size(), 3);
+}
+
+TEST(IndexedPriorityQueueTest, DecreaseKeyAndErase) {
+  s21::IndexedPriorityQueue<int, std::greater<int>> a;
+  auto h10 = a.push(10);
+  auto h20 = a.push(20);
+  auto h30 = a.push(30);
+  EXPECT_EQ(a.top(), 10);
+  a.decrease_key(h30, 5);
+  EXPECT_EQ(a.top(), 5);
+  EXPECT_EQ(a.top_handle(), h30);
+  EXPECT_ANY_THROW(a.decrease_key(h20, 25));
+  a.erase(h30);
+  EXPECT_FALSE(a.contains(h30));
+  EXPECT_EQ(a.top(), 10);
+  a.update(h10, 40);
+  EXPECT_EQ(a.top(), 20);
+  EXPECT_EQ(a.value(h10), 40);
+  a.pop();
+  EXPECT_EQ(a.top(), 40);
+  EXPECT_EQ(a.size(), 1);
+  EXPECT_ANY_THROW(a.erase(h20));
+}
+
+TEST(IndexedPriorityQueueTest, HandlesAreRecycled) {
+  s21::IndexedPriorityQueue<int> a;
+  auto h = a.push(1);
+  a.pop();
+  EXPECT_EQ(a.push(2), h);
+}
+
+TEST(IndexedPriorityQueueTest, DijkstraOrder) {
+  std::mt19937 rng(7);
+  s21::IndexedPriorityQueue<int, std::greater<int>, 4> a;
+  std::vector<std::size_t> handles;
+  std::vector<int> keys;
+  for (int i = 0; i < 2000; ++i) {
+    keys.push_back(static_cast<int>(rng() % 100000) + 1000);
+    handles.push_back(a.push(keys.back()));
+  }
+  for (int i = 0; i < 2000; ++i) {
+    std::size_t k = rng() % keys.size();
+    if (!a.contains(handles[k])) continue;
+    keys[k] -= static_cast<int>(rng() % 1000);
+    a.decrease_key(handles[k], keys[k]);
+  }
+  std::sort(keys.begin(), keys.end());
+  for (int key : keys) {
+    EXPECT_EQ(a.top(), key);
+    a.pop();
+  }
+  EXPECT_TRUE(a.empty());
+}
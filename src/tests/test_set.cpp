@@ -1,5 +1,14 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../lib/s21_parallel_tree.h"
 #include "../lib/s21_set.h"
 
 TEST(SetTest, DefaultConstructor) {
@@ -166,4 +175,211 @@ TEST(SetTest, insert_many) {
   EXPECT_EQ(a.contains(3), 1);
   EXPECT_EQ(a.contains(4), 1);
   EXPECT_EQ(a.contains(5), 1);
-}
\ No newline at end of file
+}
+
+TEST(SetTest, EmplaceAndMoveInsert) {
+  s21::Set<std::string> a;
+  EXPECT_TRUE(a.emplace(3, 'x').second);
+  EXPECT_FALSE(a.emplace("xxx").second);
+  std::string long_key(40, 'k');
+  EXPECT_TRUE(a.insert(std::move(long_key)).second);
+  EXPECT_TRUE(long_key.empty());
+  a.emplace_hint(a.begin(), "a");
+  EXPECT_EQ(a.size(), 3);
+  EXPECT_EQ((*a.begin()).first, "a");
+  EXPECT_TRUE(a.contains(std::string(40, 'k')));
+}
+
+TEST(SetTest, CustomCompareAndTransparentLookup) {
+  s21::Set<int, std::greater<int>> a{1, 5, 3};
+  EXPECT_EQ((*a.begin()).first, 5);
+  EXPECT_EQ((*a.lower_bound(4)).first, 3);
+  s21::Set<std::string, std::less<>> b{"x", "y"};
+  EXPECT_TRUE(b.contains(std::string_view("y")));
+  EXPECT_EQ(b.count(std::string_view("z")), 0);
+  EXPECT_TRUE(b.find(std::string_view("x")) == b.begin());
+}
+
+TEST(SetTest, BoundsAndRange) {
+  s21::Set<int> a{1, 3, 5, 7};
+  EXPECT_EQ((*a.lower_bound(3)).first, 3);
+  EXPECT_EQ((*a.upper_bound(3)).first, 5);
+  EXPECT_TRUE(a.upper_bound(7) == a.end());
+  auto range = a.equal_range(4);
+  EXPECT_TRUE(range.first == range.second);
+  int sum = 0;
+  for (auto &item : a.range(2, 7)) sum += item.first;
+  EXPECT_EQ(sum, 8);
+}
+
+TEST(SetTest, RankAndSelect) {
+  s21::Set<int> a;
+  for (int i = 0; i < 1000; ++i) a.insert((i * 37) % 1000);
+  s21::Set<int> b(a);
+  EXPECT_EQ(b.rank(500), 500);
+  EXPECT_EQ(b.select(999), 999);
+  EXPECT_EQ(b.count_range(100, 200), 100);
+  b.erase(b.find(150));
+  EXPECT_EQ(b.count_range(100, 200), 99);
+  EXPECT_EQ(b.select(150), 151);
+  EXPECT_EQ(a.select(150), 150);
+}
+
+TEST(SetTest, InOrderLinksSurviveChurnAndCopy) {
+  s21::Set<int> a;
+  std::set<int> b;
+  std::mt19937 rng(9);
+  for (int i = 0; i < 5000; ++i) {
+    int key = static_cast<int>(rng() % 700);
+    if (rng() % 3 == 0) {
+      if (b.erase(key)) a.erase(a.find(key));
+    } else {
+      a.insert(key);
+      b.insert(key);
+    }
+  }
+  s21::Set<int> c(a);
+  for (s21::Set<int> *set : {&a, &c}) {
+    ASSERT_EQ(set->size(), b.size());
+    auto forward = set->begin();
+    for (int key : b) {
+      EXPECT_EQ((*forward).first, key);
+      ++forward;
+    }
+    EXPECT_TRUE(forward == set->end());
+    auto backward = set->nth_element_iterator(set->size() - 1);
+    for (auto it = b.rbegin(); it != b.rend(); ++it) {
+      EXPECT_EQ((*backward).first, *it);
+      --backward;
+    }
+    EXPECT_TRUE(backward == set->end());
+  }
+}
+
+TEST(SetTest, InsertSortedDeduplicates) {
+  std::vector<int> batch{4, 2, 2, 9};
+  s21::Set<int> a(batch.begin(), batch.end());
+  EXPECT_EQ(a.size(), 3);
+  std::vector<int> more{1, 2, 10};
+  a.insert_sorted(more.begin(), more.end());
+  EXPECT_EQ(a.size(), 5);
+  EXPECT_EQ(a.select(0), 1);
+  EXPECT_EQ(a.select(4), 10);
+}
+
+TEST(SetTest, ExtractAndMerge) {
+  s21::Set<int> a{1, 2, 3};
+  s21::Set<int> b{3, 4};
+  auto handle = a.extract(1);
+  EXPECT_EQ(handle.value(), 1);
+  EXPECT_TRUE(b.insert(std::move(handle)).inserted);
+  a.merge(b);
+  EXPECT_EQ(a.size(), 4);
+  EXPECT_EQ(b.size(), 1);
+  EXPECT_TRUE(b.contains(3));
+  EXPECT_EQ(a.select(0), 1);
+  EXPECT_EQ(a.select(3), 4);
+}
+
+TEST(SetTest, RangeEraseAndExtractRange) {
+  s21::Set<int> a;
+  for (int i = 0; i < 100; ++i) a.insert(i);
+  a.erase(a.find(10), a.find(20));
+  EXPECT_EQ(a.size(), 90);
+  EXPECT_EQ(a.select(10), 20);
+  s21::Set<int> tail = a.extract_range(50, 1000);
+  EXPECT_EQ(tail.size(), 50);
+  EXPECT_EQ(a.size(), 40);
+  EXPECT_EQ(a.erase_if([](int value) { return value < 5; }), 5);
+  EXPECT_EQ((*a.begin()).first, 5);
+}
+
+TEST(SetTest, ExtractRangeOfLiterals) {
+  s21::Set<std::string, std::less<>> a{"a", "c", "d", "e", "f", "g"};
+  EXPECT_TRUE(a.extract_range("f", "c").empty());
+  s21::Set<std::string, std::less<>> middle = a.extract_range("c", "f");
+  EXPECT_EQ(middle.size(), 3);
+  EXPECT_EQ(a.size(), 3);
+  EXPECT_FALSE(a.contains("d"));
+}
+
+namespace {
+enum class SetOp { kUnion, kIntersection, kDifference, kSymmetric };
+
+template <class Fork>
+void CheckSetOp(SetOp op, Fork fork, unsigned seed) {
+  std::mt19937 rng(static_cast<unsigned>(op) + seed);
+  std::set<int> left;
+  std::set<int> right;
+  for (int i = 0; i < 20000; ++i) left.insert(static_cast<int>(rng() % 60000));
+  for (int i = 0; i < 9000; ++i) right.insert(static_cast<int>(rng() % 60000));
+  s21::Set<int> a(left.begin(), left.end());
+  s21::Set<int> b(right.begin(), right.end());
+  std::vector<int> expected;
+  auto out = std::back_inserter(expected);
+  switch (op) {
+    case SetOp::kUnion:
+      std::set_union(left.begin(), left.end(), right.begin(), right.end(),
+                     out);
+      a.set_union(b, fork);
+      break;
+    case SetOp::kIntersection:
+      std::set_intersection(left.begin(), left.end(), right.begin(),
+                            right.end(), out);
+      a.set_intersection(b, fork);
+      break;
+    case SetOp::kDifference:
+      std::set_difference(left.begin(), left.end(), right.begin(),
+                          right.end(), out);
+      a.set_difference(b, fork);
+      break;
+    case SetOp::kSymmetric:
+      std::set_symmetric_difference(left.begin(), left.end(), right.begin(),
+                                    right.end(), out);
+      a.set_symmetric_difference(b, fork);
+      break;
+  }
+  EXPECT_TRUE(b.empty());
+  ASSERT_EQ(a.size(), expected.size());
+  auto it = a.begin();
+  for (std::size_t i = 0; i < expected.size(); ++i, ++it) {
+    ASSERT_EQ((*it).first, expected[i]);
+    ASSERT_EQ(a.select(i), expected[i]);
+  }
+  if (expected.empty()) return;
+  it = a.nth_element_iterator(expected.size() - 1);
+  for (auto item = expected.rbegin(); item != expected.rend(); ++item, --it) {
+    ASSERT_EQ((*it).first, *item);
+  }
+}
+}  // namespace
+
+TEST(SetTest, SetAlgebraMatchesStd) {
+  for (SetOp op : {SetOp::kUnion, SetOp::kIntersection, SetOp::kDifference,
+                   SetOp::kSymmetric}) {
+    CheckSetOp(op, SequentialFork(), 0);
+  }
+}
+
+TEST(SetTest, ParallelSetAlgebraMatchesStd) {
+  s21::TaskScheduler scheduler(3);
+  for (SetOp op : {SetOp::kUnion, SetOp::kIntersection, SetOp::kDifference,
+                   SetOp::kSymmetric}) {
+    CheckSetOp(op, s21::ParallelFork(scheduler), 10);
+  }
+}
+
+TEST(SetTest, SetAlgebraEdgeCases) {
+  s21::Set<int> a{1, 2, 3};
+  s21::Set<int> empty;
+  a.set_union(empty);
+  EXPECT_EQ(a.size(), 3);
+  a.set_intersection(a);
+  EXPECT_EQ(a.size(), 3);
+  s21::Set<int> b{2};
+  a.set_difference(b);
+  EXPECT_EQ(a.size(), 2);
+  EXPECT_FALSE(a.contains(2));
+  a.set_symmetric_difference(a);
+  EXPECT_TRUE(a.empty());
+}
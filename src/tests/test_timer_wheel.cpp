@@ -0,0 +1,147 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../lib/s21_timer_wheel.h"
+
+TEST(TimerWheelTest, FiresAtDeadline) {
+  s21::TimerWheel<int> wheel;
+  wheel.schedule(5, 1);
+  wheel.schedule(3, 2);
+  wheel.schedule(5, 3);
+  EXPECT_EQ(wheel.size(), 3);
+  s21::Vector<int> out;
+  EXPECT_EQ(wheel.advance(2, out), 0);
+  EXPECT_EQ(wheel.advance(3, out), 1);
+  EXPECT_EQ(out[0], 2);
+  EXPECT_EQ(wheel.advance(10, out), 2);
+  EXPECT_EQ(out[1], 1);
+  EXPECT_EQ(out[2], 3);
+  EXPECT_TRUE(wheel.empty());
+  EXPECT_EQ(wheel.now(), 10);
+}
+
+TEST(TimerWheelTest, PastDeadlineFiresOnNextAdvance) {
+  s21::TimerWheel<int> wheel(100);
+  wheel.schedule(50, 7);
+  wheel.schedule(100, 8);
+  s21::Vector<int> out;
+  EXPECT_EQ(wheel.advance(100, out), 2);
+}
+
+TEST(TimerWheelTest, CancelAndReschedule) {
+  s21::TimerWheel<std::string> wheel;
+  auto a = wheel.schedule(10, "a");
+  auto b = wheel.schedule(20, "b");
+  EXPECT_TRUE(wheel.cancel(a));
+  EXPECT_FALSE(wheel.cancel(a));
+  EXPECT_FALSE(wheel.contains(a));
+  EXPECT_TRUE(wheel.reschedule(b, 70000));
+  s21::Vector<std::string> out;
+  EXPECT_EQ(wheel.advance(69999, out), 0);
+  EXPECT_EQ(wheel.advance(70000, out), 1);
+  EXPECT_EQ(out[0], "b");
+  EXPECT_FALSE(wheel.reschedule(b, 1));
+}
+
+TEST(TimerWheelTest, StaleHandleAfterReuse) {
+  s21::TimerWheel<int> wheel;
+  auto a = wheel.schedule(1, 1);
+  wheel.cancel(a);
+  auto b = wheel.schedule(2, 2);
+  EXPECT_FALSE(wheel.cancel(a));
+  EXPECT_TRUE(wheel.contains(b));
+}
+
+TEST(TimerWheelTest, CascadesAcrossLevelsAndOverflow) {
+  s21::TimerWheel<std::uint64_t> wheel(7);
+  std::vector<std::uint64_t> deadlines{
+      256, 257, 65535, 65536, 16777216, 4294967296ull, 1ull << 40,
+      (1ull << 40) + 3};
+  for (auto d : deadlines) wheel.schedule(d, d);
+  std::vector<std::uint64_t> fired;
+  auto collect = [&](std::uint64_t value) {
+    EXPECT_EQ(value, wheel.now());
+    fired.push_back(value);
+  };
+  for (auto d : deadlines) {
+    wheel.advance(d - 1, collect);
+    wheel.advance(d, collect);
+  }
+  EXPECT_EQ(fired, deadlines);
+}
+
+TEST(TimerWheelTest, MatchesOrderedModel) {
+  s21::TimerWheel<int> wheel;
+  std::multimap<std::uint64_t, int> model;
+  std::map<int, s21::TimerWheel<int>::handle_type> handles;
+  std::mt19937_64 rng(7);
+  int next_id = 0;
+  for (int round = 0; round < 2000; ++round) {
+    for (int i = 0; i < 5; ++i) {
+      std::uint64_t span = std::uint64_t{1} << (rng() % 20);
+      std::uint64_t deadline = wheel.now() + rng() % span;
+      handles[next_id] = wheel.schedule(deadline, next_id);
+      model.emplace(deadline, next_id++);
+    }
+    if (!handles.empty() && rng() % 2) {
+      auto it = handles.begin();
+      std::advance(it, rng() % handles.size());
+      for (auto m = model.begin(); m != model.end(); ++m) {
+        if (m->second == it->first) {
+          model.erase(m);
+          break;
+        }
+      }
+      EXPECT_TRUE(wheel.cancel(it->second));
+      handles.erase(it);
+    }
+    std::uint64_t now = wheel.now() + rng() % 3000;
+    std::vector<int> fired;
+    wheel.advance(now, [&](int id) {
+      fired.push_back(id);
+      handles.erase(id);
+    });
+    std::vector<int> expected;
+    while (!model.empty() && model.begin()->first <= now) {
+      expected.push_back(model.begin()->second);
+      model.erase(model.begin());
+    }
+    std::sort(fired.begin(), fired.end());
+    std::sort(expected.begin(), expected.end());
+    ASSERT_EQ(fired, expected);
+    ASSERT_EQ(wheel.size(), model.size());
+  }
+}
+
+TEST(TtlMapTest, ExpiresEntries) {
+  s21::TtlMap<std::string, int> cache;
+  cache.insert_or_assign("a", 1, 10);
+  cache.insert_or_assign("b", 2, 20);
+  ASSERT_NE(cache.find("a"), nullptr);
+  EXPECT_EQ(*cache.find("a"), 1);
+  EXPECT_EQ(cache.expire(15), 1);
+  EXPECT_FALSE(cache.contains("a"));
+  EXPECT_TRUE(cache.contains("b"));
+  EXPECT_EQ(cache.size(), 1);
+}
+
+TEST(TtlMapTest, TouchAndReassign) {
+  s21::TtlMap<int, std::string> cache;
+  cache.insert_or_assign(1, "x", 5);
+  EXPECT_TRUE(cache.touch(1, 50));
+  EXPECT_FALSE(cache.touch(2, 50));
+  EXPECT_EQ(cache.expire(10), 0);
+  cache.insert_or_assign(1, "y", 100);
+  EXPECT_EQ(cache.expire(60), 0);
+  EXPECT_EQ(*cache.find(1), "y");
+  EXPECT_TRUE(cache.erase(1));
+  EXPECT_FALSE(cache.erase(1));
+  EXPECT_EQ(cache.expire(200), 0);
+  EXPECT_TRUE(cache.empty());
+}
@@ -0,0 +1,173 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "../lib/s21_unordered_map.h"
+
+namespace {
+struct StringHash {
+  using is_transparent = void;
+  std::size_t operator()(std::string_view s) const {
+    return std::hash<std::string_view>()(s);
+  }
+};
+
+struct StringEqual {
+  using is_transparent = void;
+  bool operator()(std::string_view a, std::string_view b) const {
+    return a == b;
+  }
+};
+
+// A hash that sends every key to the same group and control byte, so
+// probing, tombstones and full-group scans are all exercised.
+struct Collide {
+  std::size_t operator()(int) const { return 0; }
+};
+}  // namespace
+
+TEST(UnorderedMapTest, InsertFindErase) {
+  s21::UnorderedMap<int, std::string> map{{1, "a"}, {2, "b"}};
+  EXPECT_EQ(map.size(), 2);
+  EXPECT_TRUE(map.insert(3, "c").second);
+  EXPECT_FALSE(map.insert({3, "x"}).second);
+  EXPECT_EQ(map.at(3), "c");
+  EXPECT_THROW(map.at(4), std::out_of_range);
+  map[4] = "d";
+  EXPECT_EQ(map.find(4)->second, "d");
+  EXPECT_EQ(map.find(5), map.end());
+  EXPECT_FALSE(map.insert_or_assign(4, "e").second);
+  EXPECT_EQ(map[4], "e");
+  EXPECT_TRUE(map.contains(1));
+  EXPECT_EQ(map.count(9), 0);
+  EXPECT_EQ(map.erase(1), 1);
+  EXPECT_EQ(map.erase(1), 0);
+  map.erase(map.find(2));
+  EXPECT_EQ(map.size(), 2);
+  std::map<int, std::string> seen(map.begin(), map.end());
+  EXPECT_EQ(seen, (std::map<int, std::string>{{3, "c"}, {4, "e"}}));
+  map.clear();
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.begin(), map.end());
+}
+
+TEST(UnorderedMapTest, TryEmplaceConstructsOnlyWhenAbsent) {
+  s21::UnorderedMap<std::string, std::string> map;
+  std::string value = "moved";
+  EXPECT_TRUE(map.try_emplace("k", std::move(value)).second);
+  std::string again = "kept";
+  EXPECT_FALSE(map.try_emplace("k", std::move(again)).second);
+  EXPECT_EQ(again, "kept");
+  EXPECT_EQ(map.at("k"), "moved");
+  EXPECT_TRUE(map.emplace("e", "v").second);
+  EXPECT_EQ(map.at("e"), "v");
+}
+
+TEST(UnorderedMapTest, TryEmplaceCopiesElementAcrossRehash) {
+  s21::UnorderedMap<int, std::string> map;
+  map.insert(0, std::string(64, 'x'));
+  for (int i = 1; i < 200; ++i) map.try_emplace(i, map.at(0));
+  for (int i = 0; i < 200; ++i) EXPECT_EQ(map.at(i), std::string(64, 'x'));
+  map.insert_or_assign(-1, map.at(0));
+  EXPECT_EQ(map.at(-1), std::string(64, 'x'));
+}
+
+TEST(UnorderedMapTest, InsertReusesTombstoneWithoutGrowing) {
+  s21::UnorderedMap<int, int, Collide> map;
+  map.reserve(28);
+  for (int i = 0; i < 28; ++i) map.insert(i, i);
+  auto buckets = map.bucket_count();
+  EXPECT_EQ(map.erase(0), 1);
+  EXPECT_TRUE(map.insert(100, 100).second);
+  EXPECT_EQ(map.bucket_count(), buckets);
+  for (int i = 1; i < 28; ++i) EXPECT_EQ(map.at(i), i);
+  EXPECT_EQ(map.at(100), 100);
+}
+
+TEST(UnorderedMapTest, HeterogeneousLookup) {
+  s21::UnorderedMap<std::string, int, StringHash, StringEqual> map;
+  map.insert("alpha", 1);
+  std::string_view probe = "alpha";
+  EXPECT_EQ(map.find(probe)->second, 1);
+  EXPECT_TRUE(map.contains(std::string_view("alpha")));
+  EXPECT_EQ(map.count(std::string_view("beta")), 0);
+  EXPECT_EQ(map.at(probe), 1);
+}
+
+TEST(UnorderedMapTest, ReserveAvoidsRehash) {
+  s21::UnorderedMap<int, int> map;
+  map.reserve(1000);
+  auto buckets = map.bucket_count();
+  EXPECT_GE(buckets * 7 / 8, 1000);
+  for (int i = 0; i < 1000; ++i) map.insert(i, i);
+  EXPECT_EQ(map.bucket_count(), buckets);
+  EXPECT_LE(map.load_factor(), 0.875f);
+}
+
+TEST(UnorderedMapTest, CollidingKeysSurviveErase) {
+  s21::UnorderedMap<int, int, Collide> map;
+  for (int i = 0; i < 100; ++i) map.insert(i, i);
+  for (int i = 0; i < 100; i += 3) EXPECT_EQ(map.erase(i), 1);
+  for (int i = 0; i < 100; ++i) EXPECT_EQ(map.contains(i), i % 3 != 0);
+  for (int i = 0; i < 100; i += 3) map.insert(i, -i);
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_EQ(map.at(i), i % 3 ? i : -i);
+  }
+  EXPECT_EQ(map.size(), 100);
+}
+
+TEST(UnorderedMapTest, MatchesModel) {
+  s21::UnorderedMap<int, int> map;
+  std::unordered_map<int, int> model;
+  std::mt19937 rng(48);
+  for (int step = 0; step < 100000; ++step) {
+    int key = static_cast<int>(rng() % 3000);
+    switch (rng() % 4) {
+      case 0:
+      case 1:
+        map.insert_or_assign(key, step);
+        model[key] = step;
+        break;
+      case 2:
+        ASSERT_EQ(map.erase(key), model.erase(key));
+        break;
+      default:
+        ASSERT_EQ(map.contains(key), model.count(key) == 1);
+    }
+  }
+  ASSERT_EQ(map.size(), model.size());
+  std::size_t visited = 0;
+  for (const auto &item : map) {
+    ASSERT_EQ(model.at(item.first), item.second);
+    ++visited;
+  }
+  EXPECT_EQ(visited, model.size());
+}
+
+TEST(UnorderedMapTest, CopyMoveSwapMerge) {
+  s21::UnorderedMap<int, std::string> a{{1, "a"}, {2, "b"}};
+  s21::UnorderedMap<int, std::string> b = a;
+  b[3] = "c";
+  EXPECT_EQ(a.size(), 2);
+  EXPECT_EQ(b.size(), 3);
+  s21::UnorderedMap<int, std::string> c = std::move(b);
+  EXPECT_EQ(c.size(), 3);
+  EXPECT_TRUE(b.empty());
+  s21::UnorderedMap<int, std::string> d{{3, "x"}, {4, "d"}};
+  a.merge(d);
+  EXPECT_EQ(a.size(), 4);
+  EXPECT_EQ(a.at(3), "x");
+  EXPECT_EQ(d.size(), 0);
+  c.merge(a);
+  EXPECT_EQ(c.size(), 4);
+  EXPECT_EQ(c.at(3), "c");
+  EXPECT_EQ(a.size(), 3);
+  a.swap(c);
+  EXPECT_EQ(a.size(), 4);
+  c.insert_many(std::make_pair(9, std::string("z")));
+  EXPECT_EQ(c.at(9), "z");
+}
@@ -0,0 +1,50 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <set>
+#include <string>
+#include <unordered_set>
+
+#include "../lib/s21_unordered_set.h"
+
+TEST(UnorderedSetTest, InsertFindErase) {
+  s21::UnorderedSet<std::string> set{"a", "b", "a"};
+  EXPECT_EQ(set.size(), 2);
+  EXPECT_TRUE(set.insert("c").second);
+  EXPECT_FALSE(set.insert("c").second);
+  EXPECT_EQ(*set.find("b"), "b");
+  EXPECT_EQ(set.find("z"), set.end());
+  EXPECT_TRUE(set.contains("a"));
+  EXPECT_EQ(set.erase("a"), 1);
+  set.erase(set.find("b"));
+  EXPECT_EQ(std::set<std::string>(set.begin(), set.end()),
+            std::set<std::string>{"c"});
+  EXPECT_TRUE(set.emplace(3, 'x').second);
+  EXPECT_TRUE(set.contains("xxx"));
+}
+
+TEST(UnorderedSetTest, MatchesModelThroughGrowth) {
+  s21::UnorderedSet<int> set;
+  std::unordered_set<int> model;
+  std::mt19937 rng(8);
+  for (int step = 0; step < 100000; ++step) {
+    int key = static_cast<int>(rng() % 20000);
+    if (rng() % 3) {
+      ASSERT_EQ(set.insert(key).second, model.insert(key).second);
+    } else {
+      ASSERT_EQ(set.erase(key), model.erase(key));
+    }
+  }
+  EXPECT_EQ(set.size(), model.size());
+  EXPECT_EQ(std::set<int>(set.begin(), set.end()),
+            std::set<int>(model.begin(), model.end()));
+}
+
+TEST(UnorderedSetTest, MergeKeepsDuplicatesInSource) {
+  s21::UnorderedSet<int> a{1, 2, 3};
+  s21::UnorderedSet<int> b{3, 4};
+  a.merge(b);
+  EXPECT_EQ(a.size(), 4);
+  EXPECT_EQ(b.size(), 1);
+  EXPECT_TRUE(b.contains(3));
+}
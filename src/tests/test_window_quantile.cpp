@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <deque>
+#include <iterator>
+#include <random>
+#include <sstream>
+#include <vector>
+
+#include "../lib/s21_window_quantile.h"
+
+TEST(WindowQuantileTest, MedianAndExtremes) {
+  s21::WindowQuantile<int> window(5);
+  EXPECT_THROW(window.median(), std::out_of_range);
+  for (int sample : {7, 1, 5, 3, 9}) window.push(sample);
+  EXPECT_EQ(window.size(), 5);
+  EXPECT_EQ(window.median(), 5);
+  EXPECT_EQ(window.min(), 1);
+  EXPECT_EQ(window.max(), 9);
+  EXPECT_EQ(window.quantile(0.8), 7);
+  EXPECT_EQ(window.rank(6), 3);
+  EXPECT_THROW(window.quantile(1.5), std::invalid_argument);
+}
+
+TEST(WindowQuantileTest, EvictsOldestFirst) {
+  s21::WindowQuantile<int> window(3);
+  for (int sample : {100, 1, 2, 3}) window.push(sample);
+  EXPECT_EQ(window.size(), 3);
+  EXPECT_EQ(window.max(), 3);
+  window.push(3);
+  window.push(3);
+  EXPECT_EQ(window.min(), 3);
+}
+
+TEST(WindowQuantileTest, PushManyKeepsNewest) {
+  s21::WindowQuantile<int> window(4);
+  window.push(-50);
+  std::vector<int> batch{10, 20, 30, 40, 50, 60};
+  window.push_many(batch.begin(), batch.end());
+  EXPECT_EQ(window.size(), 4);
+  EXPECT_EQ(window.min(), 30);
+  std::vector<int> small{1, 2};
+  window.push_many(small.begin(), small.end());
+  EXPECT_EQ(window.min(), 1);
+  EXPECT_EQ(window.max(), 60);
+}
+
+TEST(WindowQuantileTest, PushManyReadsSinglePassInputOnce) {
+  s21::WindowQuantile<int> window(4);
+  window.push(-50);
+  std::istringstream long_batch("10 20 30 40 50 60");
+  window.push_many(std::istream_iterator<int>(long_batch),
+                   std::istream_iterator<int>());
+  EXPECT_EQ(window.size(), 4);
+  EXPECT_EQ(window.min(), 30);
+  EXPECT_EQ(window.max(), 60);
+  std::istringstream short_batch("1 2");
+  window.push_many(std::istream_iterator<int>(short_batch),
+                   std::istream_iterator<int>());
+  EXPECT_EQ(window.min(), 1);
+  EXPECT_EQ(window.max(), 60);
+  window.push(0);
+  window.push(0);
+  EXPECT_EQ(window.max(), 2);
+}
+
+TEST(WindowQuantileTest, MatchesSortedWindow) {
+  const std::size_t kWindow = 257;
+  s21::WindowQuantile<int> window(kWindow);
+  std::deque<int> recent;
+  std::mt19937 rng(5);
+  for (int i = 0; i < 5000; ++i) {
+    int sample = static_cast<int>(rng() % 1000);
+    window.push(sample);
+    recent.push_back(sample);
+    if (recent.size() > kWindow) recent.pop_front();
+    if (i % 50 == 0) {
+      std::vector<int> sorted(recent.begin(), recent.end());
+      std::sort(sorted.begin(), sorted.end());
+      for (double q : {0.0, 0.25, 0.5, 0.95, 0.99, 1.0}) {
+        std::size_t rank =
+            static_cast<std::size_t>(std::ceil(q * sorted.size()));
+        EXPECT_EQ(window.quantile(q), sorted[rank ? rank - 1 : 0]);
+      }
+    }
+  }
+}
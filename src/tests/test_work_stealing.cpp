@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "../lib/s21_task_scheduler.h"
+#include "../lib/s21_work_stealing_deque.h"
+
+TEST(WorkStealingDequeTest, OwnerIsLifoThiefIsFifo) {
+  s21::WorkStealingDeque<int> a;
+  for (int i = 0; i < 4; ++i) a.push(i);
+  EXPECT_EQ(a.size(), 4);
+  int value = -1;
+  EXPECT_TRUE(a.steal(value));
+  EXPECT_EQ(value, 0);
+  EXPECT_TRUE(a.pop(value));
+  EXPECT_EQ(value, 3);
+  EXPECT_TRUE(a.pop(value));
+  EXPECT_TRUE(a.pop(value));
+  EXPECT_EQ(value, 1);
+  EXPECT_FALSE(a.pop(value));
+  EXPECT_FALSE(a.steal(value));
+  EXPECT_TRUE(a.empty());
+}
+
+TEST(WorkStealingDequeTest, Grows) {
+  s21::WorkStealingDeque<int> a(2);
+  for (int i = 0; i < 1000; ++i) a.push(i);
+  EXPECT_GE(a.capacity(), 1000);
+  int value = 0;
+  for (int i = 999; i >= 0; --i) {
+    EXPECT_TRUE(a.pop(value));
+    EXPECT_EQ(value, i);
+  }
+}
+
+TEST(WorkStealingDequeTest, ConcurrentThievesTakeEachItemOnce) {
+  const int kItems = 100000;
+  const int kThieves = 3;
+  s21::WorkStealingDeque<int> a(4);
+  std::atomic<bool> done{false};
+  std::atomic<long long> stolen_sum{0};
+  std::vector<std::thread> thieves;
+  for (int t = 0; t < kThieves; ++t) {
+    thieves.emplace_back([&] {
+      int value = 0;
+      long long sum = 0;
+      while (!done.load() || !a.empty()) {
+        if (a.steal(value)) sum += value;
+      }
+      stolen_sum += sum;
+    });
+  }
+  long long own_sum = 0;
+  int value = 0;
+  for (int i = 1; i <= kItems; ++i) {
+    a.push(i);
+    if (i % 3 == 0 && a.pop(value)) own_sum += value;
+  }
+  while (a.pop(value)) own_sum += value;
+  done = true;
+  for (auto &thief : thieves) thief.join();
+  EXPECT_EQ(own_sum + stolen_sum,
+            static_cast<long long>(kItems) * (kItems + 1) / 2);
+}
+
+namespace {
+long long fib(s21::TaskScheduler &scheduler, int n) {
+  if (n < 12) return n < 2 ? n : fib(scheduler, n - 1) + fib(scheduler, n - 2);
+  long long a = 0;
+  s21::TaskGroup group(scheduler);
+  group.spawn([&] { a = fib(scheduler, n - 1); });
+  long long b = fib(scheduler, n - 2);
+  group.sync();
+  return a + b;
+}
+}  // namespace
+
+TEST(TaskSchedulerTest, RecursiveSpawnSync) {
+  s21::TaskScheduler scheduler(4);
+  EXPECT_EQ(scheduler.size(), 4);
+  EXPECT_EQ(fib(scheduler, 22), 17711);
+}
+
+TEST(TaskSchedulerTest, ParallelForVisitsEveryIndexOnce) {
+  s21::TaskScheduler scheduler(3);
+  std::vector<std::atomic<int>> hits(10000);
+  s21::parallel_for(scheduler, 0, 10000, 64,
+                    [&hits](int i) { hits[i].fetch_add(1); });
+  int wrong = 0;
+  for (auto &hit : hits) wrong += hit.load() != 1;
+  EXPECT_EQ(wrong, 0);
+}
+
+TEST(TaskSchedulerTest, ParallelForOverVector) {
+  s21::TaskScheduler scheduler(2);
+  s21::Vector<int> v(5000);
+  for (std::size_t i = 0; i < v.size(); ++i) v[i] = static_cast<int>(i);
+  s21::parallel_for(scheduler, v, 100, [](int &x) { x *= 2; });
+  long long sum = 0;
+  for (int x : v) sum += x;
+  EXPECT_EQ(sum, 5000LL * 4999);
+}
+
+TEST(TaskSchedulerTest, SyncRethrowsTaskException) {
+  s21::TaskScheduler scheduler(2);
+  s21::TaskGroup group(scheduler);
+  group.spawn([] { throw std::runtime_error("task failed"); });
+  group.spawn([] {});
+  EXPECT_THROW(group.sync(), std::runtime_error);
+  group.sync();
+}
+
+TEST(TaskSchedulerTest, IdleWorkersWakeUpForLateWork) {
+  s21::TaskScheduler scheduler(2);
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  std::atomic<int> counter{0};
+  s21::TaskGroup group(scheduler);
+  for (int i = 0; i < 100; ++i) group.spawn([&counter] { ++counter; });
+  group.sync();
+  EXPECT_EQ(counter, 100);
+}